@@ -0,0 +1,360 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "EngineSIMD.h"
+#include "Vector3.h"
+#include "Matriz4x4.h"
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief Axis-aligned bounding box stored as min / max corners.
+      *  The default box is empty (min = +max value, max = -max value) so merging into it just
+      *  takes the other operand; isEmpty() reports boxes with min > max on any axis.
+    */
+    template <typename T>
+    struct TAABB {
+      using value_type = T;
+      using Vector3 = Vectors::TVector3<T>;
+
+      /*
+        *  @brief Minimum corner.
+      */
+      Vector3 min;
+      /*
+        *  @brief Maximum corner.
+      */
+      Vector3 max;
+
+      /*
+        *  @brief Default constructor. Creates an empty box.
+      */
+      constexpr TAABB()
+        : min(std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max()),
+          max(-std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), -std::numeric_limits<T>::max()) {}
+
+      /*
+        *  @brief Constructs a box from its corners.
+        *  @param inMin Minimum corner.
+        *  @param inMax Maximum corner.
+      */
+      constexpr TAABB(const Vector3& inMin, const Vector3& inMax) : min(inMin), max(inMax) {}
+
+      /*
+        *  @brief Box centered at center reaching halfExtents along each axis.
+      */
+      static constexpr TAABB fromCenterExtents(const Vector3& center, const Vector3& halfExtents) {
+        return TAABB(center - halfExtents, center + halfExtents);
+      }
+
+      /*
+        *  @brief Smallest box containing n points (empty for n == 0).
+      */
+      static constexpr TAABB fromPoints(const Vector3* points, size_t n) {
+        TAABB result;
+        for (size_t i = 0; i < n; ++i) {
+          result.expand(points[i]);
+        }
+        return result;
+      }
+
+      /*
+        *  @brief True if min > max on any axis.
+      */
+      constexpr bool isEmpty() const {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+      }
+
+      constexpr Vector3 center() const {
+        return Vector3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+      }
+
+      /*
+        *  @brief Full edge lengths.
+      */
+      constexpr Vector3 size() const {
+        return max - min;
+      }
+
+      /*
+        *  @brief Half edge lengths.
+      */
+      constexpr Vector3 extents() const {
+        return Vector3((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);
+      }
+
+      /*
+        *  @brief Surface area (the SAH cost metric); 0 for an empty box.
+      */
+      constexpr T surfaceArea() const {
+        if (isEmpty()) {
+          return T(0.0f);
+        }
+        Vector3 d = max - min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+      }
+
+      constexpr T volume() const {
+        if (isEmpty()) {
+          return T(0.0f);
+        }
+        Vector3 d = max - min;
+        return d.x * d.y * d.z;
+      }
+
+      /*
+        *  @brief Grows the box in place to contain a point.
+      */
+      constexpr TAABB& expand(const Vector3& point) {
+        min = Vector3(Math::EMin(min.x, point.x), Math::EMin(min.y, point.y), Math::EMin(min.z, point.z));
+        max = Vector3(Math::EMax(max.x, point.x), Math::EMax(max.y, point.y), Math::EMax(max.z, point.z));
+        return *this;
+      }
+
+      /*
+        *  @brief Grows the box in place to contain another box.
+      */
+      constexpr TAABB& expand(const TAABB& other) {
+        min = Vector3(Math::EMin(min.x, other.min.x), Math::EMin(min.y, other.min.y), Math::EMin(min.z, other.min.z));
+        max = Vector3(Math::EMax(max.x, other.max.x), Math::EMax(max.y, other.max.y), Math::EMax(max.z, other.max.z));
+        return *this;
+      }
+
+      /*
+        *  @brief Union of two boxes.
+      */
+      constexpr TAABB merge(const TAABB& other) const {
+        TAABB result = *this;
+        return result.expand(other);
+      }
+
+      constexpr TAABB merge(const Vector3& point) const {
+        TAABB result = *this;
+        return result.expand(point);
+      }
+
+      /*
+        *  @brief Overlap of two boxes; empty if they do not intersect.
+      */
+      constexpr TAABB intersection(const TAABB& other) const {
+        return TAABB(
+          Vector3(Math::EMax(min.x, other.min.x), Math::EMax(min.y, other.min.y), Math::EMax(min.z, other.min.z)),
+          Vector3(Math::EMin(max.x, other.max.x), Math::EMin(max.y, other.max.y), Math::EMin(max.z, other.max.z)));
+      }
+
+      /*
+        *  @brief True if the boxes overlap (touching counts).
+      */
+      constexpr bool intersects(const TAABB& other) const {
+        return min.x <= other.max.x && max.x >= other.min.x &&
+               min.y <= other.max.y && max.y >= other.min.y &&
+               min.z <= other.max.z && max.z >= other.min.z;
+      }
+
+      /*
+        *  @brief True if the point lies inside or on the box.
+      */
+      constexpr bool contains(const Vector3& point) const {
+        return point.x >= min.x && point.x <= max.x &&
+               point.y >= min.y && point.y <= max.y &&
+               point.z >= min.z && point.z <= max.z;
+      }
+
+      /*
+        *  @brief True if other lies entirely inside this box.
+      */
+      constexpr bool contains(const TAABB& other) const {
+        return other.min.x >= min.x && other.max.x <= max.x &&
+               other.min.y >= min.y && other.max.y <= max.y &&
+               other.min.z >= min.z && other.max.z <= max.z;
+      }
+
+      /*
+        *  @brief Bounds of the box after an affine transform (Arvo's method).
+        *  Each output axis starts at the translation and adds, per input axis, the smaller and
+        *  larger of m * min and m * max: 9 multiplies and no corner enumeration. The result is the
+        *  tightest AABB of the transformed box. The projective row of m is ignored.
+        *  @param m Column-major affine transform.
+        *  @return Transformed box (empty stays empty).
+      */
+      constexpr TAABB transform(const Matrices::TMatriz4x4<T>& m) const {
+        if (isEmpty()) {
+          return *this;
+        }
+        const T inMin[3] = { min.x, min.y, min.z };
+        const T inMax[3] = { max.x, max.y, max.z };
+        T outMin[3] = { m.m[3][0], m.m[3][1], m.m[3][2] };
+        T outMax[3] = { m.m[3][0], m.m[3][1], m.m[3][2] };
+        for (int row = 0; row < 3; ++row) {
+          for (int col = 0; col < 3; ++col) {
+            T a = m.m[col][row] * inMin[col];
+            T b = m.m[col][row] * inMax[col];
+            outMin[row] += Math::EMin(a, b);
+            outMax[row] += Math::EMax(a, b);
+          }
+        }
+        return TAABB(Vector3(outMin[0], outMin[1], outMin[2]), Vector3(outMax[0], outMax[1], outMax[2]));
+      }
+
+      constexpr bool operator==(const TAABB& other) const {
+        return min == other.min && max == other.max;
+      }
+
+      constexpr bool operator!=(const TAABB& other) const {
+        return !(*this == other);
+      }
+    };
+
+    using AABB = TAABB<float>;
+    using AABBd = TAABB<double>;
+
+    static_assert(std::is_trivially_copyable<AABB>::value, "AABB must be trivially copyable");
+    static_assert(std::is_standard_layout<AABB>::value, "AABB must be standard layout");
+    static_assert(sizeof(AABB) == 6 * sizeof(float), "AABB must stay six packed floats");
+
+    namespace detail {
+      /*
+        *  @brief Arvo transform of in[0, n) by one matrix, four lanes per column.
+      */
+      inline
+        void transformBoxesRange(const AABB* in, const Matrices::Matriz4x4& m, AABB* out, size_t n) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          SIMD::float4 c0 = SIMD::loadu4(m.m[0]);
+          SIMD::float4 c1 = SIMD::loadu4(m.m[1]);
+          SIMD::float4 c2 = SIMD::loadu4(m.m[2]);
+          SIMD::float4 c3 = SIMD::loadu4(m.m[3]);
+          for (size_t i = 0; i < n; ++i) {
+            const AABB box = in[i];
+            if (box.isEmpty()) {
+              out[i] = box;
+              continue;
+            }
+            SIMD::float4 a0 = SIMD::mul4(c0, SIMD::splat4(box.min.x));
+            SIMD::float4 b0 = SIMD::mul4(c0, SIMD::splat4(box.max.x));
+            SIMD::float4 a1 = SIMD::mul4(c1, SIMD::splat4(box.min.y));
+            SIMD::float4 b1 = SIMD::mul4(c1, SIMD::splat4(box.max.y));
+            SIMD::float4 a2 = SIMD::mul4(c2, SIMD::splat4(box.min.z));
+            SIMD::float4 b2 = SIMD::mul4(c2, SIMD::splat4(box.max.z));
+            SIMD::float4 lo = SIMD::add4(c3, SIMD::min4(a0, b0));
+            SIMD::float4 hi = SIMD::add4(c3, SIMD::max4(a0, b0));
+            lo = SIMD::add4(lo, SIMD::add4(SIMD::min4(a1, b1), SIMD::min4(a2, b2)));
+            hi = SIMD::add4(hi, SIMD::add4(SIMD::max4(a1, b1), SIMD::max4(a2, b2)));
+            float l[4], h[4];
+            SIMD::storeu4(l, lo);
+            SIMD::storeu4(h, hi);
+            out[i] = AABB(Vectors::Vector3(l[0], l[1], l[2]), Vectors::Vector3(h[0], h[1], h[2]));
+          }
+#else
+          for (size_t i = 0; i < n; ++i) {
+            out[i] = in[i].transform(m);
+          }
+#endif
+        }
+    }
+
+    /*
+      *  @brief Batch size below which the AABB batch kernels stay on the calling thread.
+    */
+    const
+      size_t AABB_BATCH_PARALLEL_THRESHOLD = 8192;
+
+    /*
+      *  @brief Computes out[i] = in[i].transform(m) for n boxes (SIMD, split across threads for large n).
+      *  out may alias in.
+      *  @param in Source boxes.
+      *  @param m Affine transform.
+      *  @param out Destination boxes.
+      *  @param n Number of boxes.
+    */
+    inline
+      void transformBatch(const AABB* in, const Matrices::Matriz4x4& m, AABB* out, size_t n) {
+        Parallel::parallelFor(0, n, AABB_BATCH_PARALLEL_THRESHOLD, [in, &m, out](size_t begin, size_t end) {
+          detail::transformBoxesRange(in + begin, m, out + begin, end - begin);
+        });
+    }
+
+    /*
+      *  @brief Computes out[i] = in[i].transform(m[i]) for n boxes, e.g. local bounds by world matrices.
+      *  out may alias in.
+    */
+    inline
+      void transformBatch(const AABB* in, const Matrices::Matriz4x4* m, AABB* out, size_t n) {
+        Parallel::parallelFor(0, n, AABB_BATCH_PARALLEL_THRESHOLD, [in, m, out](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            detail::transformBoxesRange(in + i, m[i], out + i, 1);
+          }
+        });
+    }
+
+    /*
+      *  @brief Union of n boxes (empty for n == 0).
+    */
+    inline
+      AABB mergeBatch(const AABB* boxes, size_t n) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        SIMD::float4 lo = SIMD::splat4(std::numeric_limits<float>::max());
+        SIMD::float4 hi = SIMD::splat4(-std::numeric_limits<float>::max());
+        size_t i = 0;
+        // Boxes are six packed floats, so a 4-wide load at min.x / max.x picks up one float of the
+        // next field in lane 3; that lane is ignored. The last box would read past the array and
+        // goes through the scalar path.
+        for (; i + 1 < n; ++i) {
+          lo = SIMD::min4(lo, SIMD::loadu4(&boxes[i].min.x));
+          hi = SIMD::max4(hi, SIMD::loadu4(&boxes[i].max.x));
+        }
+        float l[4], h[4];
+        SIMD::storeu4(l, lo);
+        SIMD::storeu4(h, hi);
+        AABB result(Vectors::Vector3(l[0], l[1], l[2]), Vectors::Vector3(h[0], h[1], h[2]));
+        for (; i < n; ++i) {
+          result.expand(boxes[i]);
+        }
+        return result;
+#else
+        AABB result;
+        for (size_t i = 0; i < n; ++i) {
+          result.expand(boxes[i]);
+        }
+        return result;
+#endif
+      }
+
+    /*
+      *  @brief Overlap test of one query box against n boxes.
+      *  @param query Box to test.
+      *  @param boxes Boxes to test against.
+      *  @param n Number of boxes.
+      *  @param out out[i] = 1 if boxes[i] overlaps query, else 0.
+      *  @return Number of overlapping boxes.
+    */
+    inline
+      size_t intersectsBatch(const AABB& query, const AABB* boxes, size_t n, unsigned char* out) {
+        size_t hits = 0;
+        for (size_t i = 0; i < n; ++i) {
+          const AABB& b = boxes[i];
+          unsigned char hit = (b.min.x <= query.max.x) & (b.max.x >= query.min.x) &
+                              (b.min.y <= query.max.y) & (b.max.y >= query.min.y) &
+                              (b.min.z <= query.max.z) & (b.max.z >= query.min.z);
+          out[i] = hit;
+          hits += hit;
+        }
+        return hits;
+      }
+
+    /*
+      *  @brief Output stream operator for AABB.
+    */
+    template <typename T>
+    inline std::ostream& operator<<(std::ostream& os, const TAABB<T>& box) {
+      os << "AABB(min:" << box.min << ", max:" << box.max << ")";
+      return os;
+    }
+
+  }
+}
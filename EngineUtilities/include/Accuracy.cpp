@@ -0,0 +1,474 @@
+/*
+ *  @brief Accuracy-vs-speed harness for the transcendental functions in EngineMath.h.
+ *  Sweeps each function over its domain, compares against a double-precision <cmath> reference
+ *  and reports max/mean ULP error, max absolute error and throughput next to the float <cmath> call.
+ *
+ *  Build (Linux):  g++ -O2 -std=c++17 -pthread Accuracy.cpp -o engine_accuracy
+ *  Usage:          engine_accuracy [--samples=<n>] [--exhaustive] [--format=csv|json] [--out=<file>]
+ *                                  [--filter=<substring>] [--max-ulp=<name>:<ulp>]...
+ *
+ *  --max-ulp turns the run into a release gate: the table gains "budget_ulp" and "pass" columns and
+ *  the process exits with 1 if any gated function exceeds its budget (e.g. --max-ulp=sin:4).
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "EngineUtilites.h"
+
+using namespace EngineUtilities;
+
+namespace {
+
+/*
+ *  @brief Number of inputs evaluated per call while sweeping.
+ */
+const size_t CHUNK = 4096;
+
+typedef void (*UnaryEval)(const float* in, float* out, size_t n);
+typedef void (*BinaryEval)(const float* a, const float* b, float* out, size_t n);
+typedef double (*UnaryRef)(double);
+typedef double (*BinaryRef)(double, double);
+
+/*
+ *  @brief One row of the report: a function, its domain and how to evaluate it.
+ *  Binary functions (atan2, power) set the second-argument range and the *2 callbacks.
+ */
+struct Case {
+  const char* name;
+  const char* domain;
+  double lo, hi;
+  UnaryEval eval;
+  UnaryEval stdEval;
+  UnaryRef ref;
+  double lo2, hi2;
+  BinaryEval eval2;
+  BinaryEval stdEval2;
+  BinaryRef ref2;
+  bool integerSecond;
+
+  bool binary() const { return eval2 != nullptr; }
+};
+
+struct Options {
+  size_t samples = 1u << 20;
+  bool exhaustive = false;
+  bool json = false;
+  std::string outPath;
+  std::string filter;
+  std::map<std::string, double> budgets;
+};
+
+/*
+ *  @brief Running error statistics for one function.
+ */
+struct Stats {
+  size_t count = 0;
+  size_t skipped = 0;
+  double maxUlp = 0.0;
+  double sumUlp = 0.0;
+  double maxAbs = 0.0;
+  float worstA = 0.0f;
+  float worstB = 0.0f;
+  double nsPerOp = 0.0;
+  double stdNsPerOp = 0.0;
+};
+
+/*
+ *  @brief Size of one float ULP at the (float-rounded) reference value.
+ */
+double ulpAt(double ref) {
+  float r = std::fabs(static_cast<float>(ref));
+  if (r >= std::numeric_limits<float>::max()) {
+    return static_cast<double>(r) - std::nextafter(r, 0.0f);
+  }
+  return static_cast<double>(std::nextafter(r, std::numeric_limits<float>::infinity())) - r;
+}
+
+/*
+ *  @brief Adds one evaluated sample. NaN results count as infinite error;
+ *  samples whose reference is not a finite float are skipped.
+ */
+void accumulate(Stats& st, float got, double ref, float a, float b) {
+  if (!std::isfinite(ref) || std::fabs(ref) > std::numeric_limits<float>::max()) {
+    ++st.skipped;
+    return;
+  }
+  double absErr = std::isnan(got) ? std::numeric_limits<double>::infinity() : std::fabs(got - ref);
+  double ulp = absErr / ulpAt(ref);
+  ++st.count;
+  st.sumUlp += ulp;
+  if (absErr > st.maxAbs) st.maxAbs = absErr;
+  if (ulp > st.maxUlp) {
+    st.maxUlp = ulp;
+    st.worstA = a;
+    st.worstB = b;
+  }
+}
+
+/*
+ *  @brief Produces the inputs of a one-dimensional sweep over [lo, hi]:
+ *  special values, an even linear sweep, and a log-spaced sweep that covers small magnitudes.
+ *  In exhaustive mode every representable float in [lo, hi] is visited instead.
+ */
+template <typename Fn>
+void forEachChunk(double lo, double hi, size_t samples, bool exhaustive, Fn&& fn) {
+  std::vector<float> buf;
+  buf.reserve(CHUNK);
+  auto push = [&](float v) {
+    if (v < lo || v > hi) return;
+    buf.push_back(v);
+    if (buf.size() == CHUNK) {
+      fn(buf.data(), buf.size());
+      buf.clear();
+    }
+  };
+
+  const float specials[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f,
+                             Math::HALF_PI, -Math::HALF_PI, Math::PI, -Math::PI,
+                             Math::TWO_PI, -Math::TWO_PI, 1e-6f, -1e-6f,
+                             std::nextafter(1.0f, 0.0f), -std::nextafter(1.0f, 0.0f),
+                             static_cast<float>(lo), static_cast<float>(hi) };
+  for (float v : specials) push(v);
+
+  if (exhaustive) {
+    float v = static_cast<float>(lo);
+    float end = static_cast<float>(hi);
+    while (v <= end) {
+      push(v);
+      if (v == end) break;
+      v = std::nextafter(v, std::numeric_limits<float>::infinity());
+    }
+  }
+  else {
+    size_t linear = samples / 2;
+    for (size_t i = 0; i < linear; ++i) {
+      push(static_cast<float>(lo + (hi - lo) * static_cast<double>(i) / static_cast<double>(linear - 1)));
+    }
+    double maxMag = std::fmax(std::fabs(lo), std::fabs(hi));
+    double minMag = std::fmin(1e-6, maxMag);
+    size_t logCount = (samples - linear) / 2;
+    for (size_t i = 0; i < logCount && maxMag > 0.0; ++i) {
+      double t = static_cast<double>(i) / static_cast<double>(logCount - 1);
+      float m = static_cast<float>(minMag * std::pow(maxMag / minMag, t));
+      push(m);
+      push(-m);
+    }
+  }
+  if (!buf.empty()) fn(buf.data(), buf.size());
+}
+
+/*
+ *  @brief Produces (a, b) pairs on a square grid over [lo, hi] x [lo2, hi2].
+ */
+template <typename Fn>
+void forEachPairChunk(const Case& c, size_t samples, Fn&& fn) {
+  size_t side = static_cast<size_t>(std::sqrt(static_cast<double>(samples)));
+  if (side < 2) side = 2;
+  std::vector<float> a, b;
+  a.reserve(CHUNK);
+  b.reserve(CHUNK);
+  for (size_t j = 0; j < side; ++j) {
+    double t2 = static_cast<double>(j) / static_cast<double>(side - 1);
+    float vb = static_cast<float>(c.lo2 + (c.hi2 - c.lo2) * t2);
+    if (c.integerSecond) vb = std::round(vb);
+    for (size_t i = 0; i < side; ++i) {
+      double t = static_cast<double>(i) / static_cast<double>(side - 1);
+      a.push_back(static_cast<float>(c.lo + (c.hi - c.lo) * t));
+      b.push_back(vb);
+      if (a.size() == CHUNK) {
+        fn(a.data(), b.data(), a.size());
+        a.clear();
+        b.clear();
+      }
+    }
+  }
+  if (!a.empty()) fn(a.data(), b.data(), a.size());
+}
+
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/*
+ *  @brief Times eval over one chunk of inputs until ~20 ms have elapsed.
+ *  @return Nanoseconds per element.
+ */
+template <typename Eval>
+double throughput(Eval&& eval, float* out) {
+  using Clock = std::chrono::steady_clock;
+  eval();
+  size_t reps = 1;
+  for (;;) {
+    Clock::time_point start = Clock::now();
+    for (size_t r = 0; r < reps; ++r) {
+      eval();
+      doNotOptimize(out[0]);
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (ns >= 20e6 || reps >= (size_t(1) << 24)) {
+      return ns / static_cast<double>(reps * CHUNK);
+    }
+    reps *= 2;
+  }
+}
+
+Stats runCase(const Case& c, const Options& options) {
+  Stats st;
+  std::vector<float> out(CHUNK);
+  if (c.binary()) {
+    forEachPairChunk(c, options.samples, [&](const float* a, const float* b, size_t n) {
+      c.eval2(a, b, out.data(), n);
+      for (size_t i = 0; i < n; ++i) {
+        accumulate(st, out[i], c.ref2(a[i], b[i]), a[i], b[i]);
+      }
+    });
+  }
+  else {
+    forEachChunk(c.lo, c.hi, options.samples, options.exhaustive, [&](const float* in, size_t n) {
+      c.eval(in, out.data(), n);
+      for (size_t i = 0; i < n; ++i) {
+        accumulate(st, out[i], c.ref(in[i]), in[i], 0.0f);
+      }
+    });
+  }
+
+  std::vector<float> a(CHUNK), b(CHUNK);
+  for (size_t i = 0; i < CHUNK; ++i) {
+    double t = (static_cast<double>(i) + 0.5) / static_cast<double>(CHUNK);
+    a[i] = static_cast<float>(c.lo + (c.hi - c.lo) * t);
+    b[i] = static_cast<float>(c.lo2 + (c.hi2 - c.lo2) * (1.0 - t));
+    if (c.integerSecond) b[i] = std::round(b[i]);
+  }
+  if (c.binary()) {
+    st.nsPerOp = throughput([&]() { c.eval2(a.data(), b.data(), out.data(), CHUNK); }, out.data());
+    st.stdNsPerOp = throughput([&]() { c.stdEval2(a.data(), b.data(), out.data(), CHUNK); }, out.data());
+  }
+  else {
+    st.nsPerOp = throughput([&]() { c.eval(a.data(), out.data(), CHUNK); }, out.data());
+    st.stdNsPerOp = throughput([&]() { c.stdEval(a.data(), out.data(), CHUNK); }, out.data());
+  }
+  return st;
+}
+
+/*
+ *  @brief Element-wise wrappers so scalar and batch functions share one calling convention.
+ */
+#define ENGINEUTILITIES_UNARY(NAME, EXPR) \
+  void NAME(const float* in, float* out, size_t n) { for (size_t i = 0; i < n; ++i) { float x = in[i]; out[i] = (EXPR); } }
+#define ENGINEUTILITIES_BINARY(NAME, EXPR) \
+  void NAME(const float* a, const float* b, float* out, size_t n) { for (size_t i = 0; i < n; ++i) { float y = a[i]; float x = b[i]; out[i] = (EXPR); } }
+
+ENGINEUTILITIES_UNARY(engineSin, Math::sin(x))
+ENGINEUTILITIES_UNARY(engineSinFast, Math::sin(x, Math::TrigAccuracy::Fast))
+ENGINEUTILITIES_UNARY(engineCos, Math::cos(x))
+ENGINEUTILITIES_UNARY(engineCosFast, Math::cos(x, Math::TrigAccuracy::Fast))
+ENGINEUTILITIES_UNARY(engineAtan, Math::atan(x))
+ENGINEUTILITIES_UNARY(engineAsin, Math::asin(x))
+ENGINEUTILITIES_UNARY(engineAcos, Math::acos(x))
+ENGINEUTILITIES_UNARY(engineSqrt, Math::sqrt(x))
+ENGINEUTILITIES_UNARY(engineRsqrt, Math::rsqrt(x))
+ENGINEUTILITIES_BINARY(engineAtan2, Math::atan2(y, x))
+ENGINEUTILITIES_BINARY(enginePower, Math::power(y, static_cast<int>(x)))
+
+ENGINEUTILITIES_UNARY(stdSin, std::sin(x))
+ENGINEUTILITIES_UNARY(stdCos, std::cos(x))
+ENGINEUTILITIES_UNARY(stdAtan, std::atan(x))
+ENGINEUTILITIES_UNARY(stdAsin, std::asin(x))
+ENGINEUTILITIES_UNARY(stdAcos, std::acos(x))
+ENGINEUTILITIES_UNARY(stdSqrt, std::sqrt(x))
+ENGINEUTILITIES_UNARY(stdRsqrt, 1.0f / std::sqrt(x))
+ENGINEUTILITIES_BINARY(stdAtan2, std::atan2(y, x))
+ENGINEUTILITIES_BINARY(stdPower, std::pow(y, x))
+
+#undef ENGINEUTILITIES_UNARY
+#undef ENGINEUTILITIES_BINARY
+
+void engineSinN(const float* in, float* out, size_t n) { Math::sin_n(in, out, n); }
+void engineCosN(const float* in, float* out, size_t n) { Math::cos_n(in, out, n); }
+void engineAtan2N(const float* y, const float* x, float* out, size_t n) { Math::atan2_n(y, x, out, n); }
+
+double refSin(double x) { return std::sin(x); }
+double refCos(double x) { return std::cos(x); }
+double refAtan(double x) { return std::atan(x); }
+double refAsin(double x) { return std::asin(x); }
+double refAcos(double x) { return std::acos(x); }
+double refSqrt(double x) { return std::sqrt(x); }
+double refRsqrt(double x) { return 1.0 / std::sqrt(x); }
+double refAtan2(double y, double x) { return std::atan2(y, x); }
+double refPower(double b, double e) { return std::pow(b, e); }
+
+Case unary(const char* name, const char* domain, double lo, double hi, UnaryEval eval, UnaryEval stdEval, UnaryRef ref) {
+  Case c = { name, domain, lo, hi, eval, stdEval, ref, 0.0, 0.0, nullptr, nullptr, nullptr, false };
+  return c;
+}
+
+Case binary(const char* name, const char* domain, double lo, double hi, double lo2, double hi2,
+            BinaryEval eval, BinaryEval stdEval, BinaryRef ref, bool integerSecond) {
+  Case c = { name, domain, lo, hi, nullptr, nullptr, nullptr, lo2, hi2, eval, stdEval, ref, integerSecond };
+  return c;
+}
+
+std::vector<Case> allCases() {
+  std::vector<Case> cases;
+  cases.push_back(unary("sin", "[-1e4, 1e4]", -1e4, 1e4, engineSin, stdSin, refSin));
+  cases.push_back(unary("sin(Fast)", "[-1e4, 1e4]", -1e4, 1e4, engineSinFast, stdSin, refSin));
+  cases.push_back(unary("sin_n", "[-1e4, 1e4]", -1e4, 1e4, engineSinN, stdSin, refSin));
+  cases.push_back(unary("cos", "[-1e4, 1e4]", -1e4, 1e4, engineCos, stdCos, refCos));
+  cases.push_back(unary("cos(Fast)", "[-1e4, 1e4]", -1e4, 1e4, engineCosFast, stdCos, refCos));
+  cases.push_back(unary("cos_n", "[-1e4, 1e4]", -1e4, 1e4, engineCosN, stdCos, refCos));
+  cases.push_back(unary("atan", "[-1e6, 1e6]", -1e6, 1e6, engineAtan, stdAtan, refAtan));
+  cases.push_back(unary("asin", "[-1, 1]", -1.0, 1.0, engineAsin, stdAsin, refAsin));
+  cases.push_back(unary("acos", "[-1, 1]", -1.0, 1.0, engineAcos, stdAcos, refAcos));
+  cases.push_back(unary("sqrt", "[0, FLT_MAX]", 0.0, std::numeric_limits<float>::max(), engineSqrt, stdSqrt, refSqrt));
+  cases.push_back(unary("rsqrt", "(0, FLT_MAX]", std::numeric_limits<float>::min(), std::numeric_limits<float>::max(),
+                        engineRsqrt, stdRsqrt, refRsqrt));
+  cases.push_back(binary("atan2", "[-100, 100]^2", -100.0, 100.0, -100.0, 100.0,
+                         engineAtan2, stdAtan2, refAtan2, false));
+  cases.push_back(binary("atan2_n", "[-100, 100]^2", -100.0, 100.0, -100.0, 100.0,
+                         engineAtan2N, stdAtan2, refAtan2, false));
+  cases.push_back(binary("power", "[-10, 10] x {-16..16}", -10.0, 10.0, -16.0, 16.0,
+                         enginePower, stdPower, refPower, true));
+  return cases;
+}
+
+void writeCsv(std::ostream& os, const std::vector<Case>& cases, const std::vector<Stats>& stats,
+              const Options& options) {
+  bool gated = !options.budgets.empty();
+  os << "function,domain,samples,skipped,max_ulp,mean_ulp,max_abs_err,worst_input,worst_input2,"
+        "ns_per_op,std_ns_per_op,speedup";
+  if (gated) os << ",budget_ulp,pass";
+  os << "\n";
+  char line[512];
+  for (size_t i = 0; i < cases.size(); ++i) {
+    const Stats& s = stats[i];
+    std::snprintf(line, sizeof(line), "%s,\"%s\",%zu,%zu,%.3f,%.4f,%.3g,%.9g,%.9g,%.3f,%.3f,%.3f",
+                  cases[i].name, cases[i].domain, s.count, s.skipped, s.maxUlp,
+                  s.count ? s.sumUlp / static_cast<double>(s.count) : 0.0, s.maxAbs,
+                  s.worstA, s.worstB, s.nsPerOp, s.stdNsPerOp,
+                  s.nsPerOp > 0.0 ? s.stdNsPerOp / s.nsPerOp : 0.0);
+    os << line;
+    if (gated) {
+      std::map<std::string, double>::const_iterator it = options.budgets.find(cases[i].name);
+      if (it == options.budgets.end()) os << ",,";
+      else os << "," << it->second << "," << (s.maxUlp <= it->second ? "true" : "false");
+    }
+    os << "\n";
+  }
+}
+
+void writeJson(std::ostream& os, const std::vector<Case>& cases, const std::vector<Stats>& stats,
+               const Options& options) {
+  os << "{\n  \"mode\": \"" << (options.exhaustive ? "exhaustive" : "sampled") << "\",\n";
+  os << "  \"results\": [\n";
+  char line[768];
+  for (size_t i = 0; i < cases.size(); ++i) {
+    const Stats& s = stats[i];
+    std::snprintf(line, sizeof(line),
+                  "    {\"function\": \"%s\", \"domain\": \"%s\", \"samples\": %zu, \"skipped\": %zu, "
+                  "\"max_ulp\": %.3f, \"mean_ulp\": %.4f, \"max_abs_err\": %.3g, \"worst_input\": [%.9g, %.9g], "
+                  "\"ns_per_op\": %.3f, \"std_ns_per_op\": %.3f, \"speedup\": %.3f",
+                  cases[i].name, cases[i].domain, s.count, s.skipped, s.maxUlp,
+                  s.count ? s.sumUlp / static_cast<double>(s.count) : 0.0, s.maxAbs,
+                  s.worstA, s.worstB, s.nsPerOp, s.stdNsPerOp,
+                  s.nsPerOp > 0.0 ? s.stdNsPerOp / s.nsPerOp : 0.0);
+    os << line;
+    std::map<std::string, double>::const_iterator it = options.budgets.find(cases[i].name);
+    if (it != options.budgets.end()) {
+      os << ", \"budget_ulp\": " << it->second << ", \"pass\": " << (s.maxUlp <= it->second ? "true" : "false");
+    }
+    os << "}" << (i + 1 < cases.size() ? "," : "") << "\n";
+  }
+  os << "  ]\n}\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    if (std::strncmp(arg, "--samples=", 10) == 0) {
+      options.samples = std::strtoull(arg + 10, nullptr, 10);
+      if (options.samples < 16) options.samples = 16;
+    }
+    else if (std::strcmp(arg, "--exhaustive") == 0) {
+      options.exhaustive = true;
+    }
+    else if (std::strcmp(arg, "--format=json") == 0) {
+      options.json = true;
+    }
+    else if (std::strcmp(arg, "--format=csv") == 0) {
+      options.json = false;
+    }
+    else if (std::strncmp(arg, "--out=", 6) == 0) {
+      options.outPath = arg + 6;
+    }
+    else if (std::strncmp(arg, "--filter=", 9) == 0) {
+      options.filter = arg + 9;
+    }
+    else if (std::strncmp(arg, "--max-ulp=", 10) == 0 && std::strchr(arg + 10, ':')) {
+      const char* colon = std::strrchr(arg + 10, ':');
+      options.budgets[std::string(arg + 10, colon)] = std::atof(colon + 1);
+    }
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--samples=<n>] [--exhaustive] [--format=csv|json] [--out=<file>]"
+                   " [--filter=<substring>] [--max-ulp=<name>:<ulp>]...\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    return 2;
+  }
+
+  std::vector<Case> cases;
+  std::vector<Stats> stats;
+  for (const Case& c : allCases()) {
+    if (!options.filter.empty() && std::string(c.name).find(options.filter) == std::string::npos) {
+      continue;
+    }
+    std::cerr << c.name << "...\n";
+    cases.push_back(c);
+    stats.push_back(runCase(c, options));
+  }
+
+  std::ofstream file;
+  if (!options.outPath.empty()) {
+    file.open(options.outPath);
+    if (!file) {
+      std::cerr << "cannot open " << options.outPath << "\n";
+      return 2;
+    }
+  }
+  std::ostream& os = options.outPath.empty() ? std::cout : file;
+  if (options.json) writeJson(os, cases, stats, options);
+  else writeCsv(os, cases, stats, options);
+
+  for (size_t i = 0; i < cases.size(); ++i) {
+    std::map<std::string, double>::const_iterator it = options.budgets.find(cases[i].name);
+    if (it != options.budgets.end() && stats[i].maxUlp > it->second) {
+      return 1;
+    }
+  }
+  return 0;
+}
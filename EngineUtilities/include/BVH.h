@@ -0,0 +1,614 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "EngineSIMD.h"
+#include "AABB.h"
+#include "Ray.h"
+#include "Vector3.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief One BVH node, 32 bytes so two nodes share a 64-byte cache line.
+      *  Interior nodes (count == 0) store the index of their left child in leftFirst; the right
+      *  child is always leftFirst + 1. Leaves store the first slot of their primitive range.
+    */
+    struct BVHNode {
+      AABB bounds;
+      uint32_t leftFirst;
+      uint32_t count;
+
+      constexpr bool isLeaf() const { return count != 0; }
+    };
+
+    static_assert(sizeof(BVHNode) == 32, "BVHNode must stay 32 bytes");
+    static_assert(std::is_trivially_copyable<BVHNode>::value, "BVHNode must be trivially copyable");
+
+    /*
+      *  @brief Bounding volume hierarchy over an array of AABBs (or triangles), built with binned SAH.
+      *  Nodes live in one flat array in depth-first order with sibling pairs adjacent; primitive
+      *  bounds are copied in leaf order so leaf tests stream through memory. Nodes with more than
+      *  PARALLEL_BUILD_THRESHOLD primitives bin in parallel and build their two subtrees on
+      *  separate threads; the resulting tree does not depend on the thread count.
+    */
+    class BVH {
+    public:
+      /*
+        *  @brief Primitive index reported when a query hits nothing.
+      */
+      static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+      /*
+        *  @brief SAH bins per axis (nodes with fewer than 2 * BIN_COUNT primitives use fewer).
+      */
+      static constexpr int BIN_COUNT = 16;
+
+      /*
+        *  @brief Leaves may hold up to this many primitives when splitting does not pay off.
+      */
+      static constexpr uint32_t MAX_LEAF_SIZE = 8;
+
+      /*
+        *  @brief Depth after which nodes are split at the median, which bounds the tree depth
+        *  (and the traversal stack) even for degenerate inputs.
+      */
+      static constexpr int MAX_SAH_DEPTH = 64;
+
+      /*
+        *  @brief Traversal stack size; enough for MAX_SAH_DEPTH plus a median-split tail.
+      */
+      static constexpr int STACK_SIZE = 128;
+
+      /*
+        *  @brief Node size above which binning and subtree builds are split across threads.
+      */
+      static constexpr size_t PARALLEL_BUILD_THRESHOLD = 65536;
+
+      /*
+        *  @brief Closest hit of a ray query.
+      */
+      struct RayHit {
+        float t;
+        uint32_t primitive;
+
+        constexpr bool hit() const { return primitive != INVALID_INDEX; }
+      };
+
+      inline BVH() {}
+
+      /*
+        *  @brief Builds the hierarchy over n boxes. Primitive i of every query is boxes[i].
+      */
+      inline void build(const AABB* boxes, size_t n) {
+        m_nodes.clear();
+        m_indices.resize(n);
+        m_primBounds.clear();
+        if (n == 0) {
+          return;
+        }
+
+        // Build records are partitioned in place, so every pass streams through contiguous memory.
+        std::vector<BuildPrimitive> work(n);
+        Parallel::parallelFor(0, n, PARALLEL_BUILD_THRESHOLD, [&work, boxes](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            work[i].bounds = boxes[i];
+            work[i].centroid = boxes[i].center();
+            work[i].index = static_cast<uint32_t>(i);
+          }
+        });
+
+        std::vector<BVHNode> scratch(2 * n - 1);
+        buildNode(work, scratch, 0, 0, static_cast<uint32_t>(n), 1, 0, measure(work, 0, static_cast<uint32_t>(n)));
+        compact(scratch);
+
+        m_primBounds.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+          m_indices[i] = work[i].index;
+          m_primBounds[i] = work[i].bounds;
+        }
+      }
+
+      /*
+        *  @brief Builds the hierarchy over triangleCount triangles stored as vertex triples
+        *  (vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2]). Primitive i is triangle i.
+      */
+      inline void buildTriangles(const Vectors::Vector3* vertices, size_t triangleCount) {
+        std::vector<AABB> boxes(triangleCount);
+        Parallel::parallelFor(0, triangleCount, PARALLEL_BUILD_THRESHOLD, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            boxes[i] = AABB(vertices[3 * i], vertices[3 * i]).expand(vertices[3 * i + 1]).expand(vertices[3 * i + 2]);
+          }
+        });
+        build(boxes.data(), triangleCount);
+      }
+
+      inline bool empty() const { return m_nodes.empty(); }
+      inline size_t nodeCount() const { return m_nodes.size(); }
+      inline size_t primitiveCount() const { return m_indices.size(); }
+      inline const std::vector<BVHNode>& nodes() const { return m_nodes; }
+
+      /*
+        *  @brief Bounds of everything in the hierarchy (empty box if nothing was built).
+      */
+      inline AABB bounds() const { return m_nodes.empty() ? AABB() : m_nodes[0].bounds; }
+
+      /*
+        *  @brief Closest-hit ray query.
+        *  Children are visited near-first and subtrees beyond the closest hit so far are skipped.
+        *  @param ray Ray to cast (t is in units of the ray direction).
+        *  @param tMax Maximum distance.
+        *  @param intersect Callable (uint32_t primitive, float tBest) -> float returning the hit
+        *  distance of the primitive, or any value >= tBest on a miss. Called only for primitives
+        *  whose bounds the ray enters before tBest.
+        *  @return Closest hit, or { tMax, INVALID_INDEX }.
+      */
+      template <typename Fn>
+      inline RayHit raycast(const Ray& ray, float tMax, Fn&& intersect) const {
+        RayHit best = raycastSlots(ray, ray.inverseDirection(), tMax, [&](uint32_t slot, float tBest) {
+          return intersect(m_indices[slot], tBest);
+        });
+        if (best.hit()) {
+          best.primitive = m_indices[best.primitive];
+        }
+        return best;
+      }
+
+      /*
+        *  @brief Closest primitive box hit by a ray (entry distance, 0 if the origin is inside the box).
+      */
+      inline RayHit raycast(const Ray& ray, float tMax) const {
+        const Vectors::Vector3 inv = ray.inverseDirection();
+        RayHit best = raycastSlots(ray, inv, tMax, [&](uint32_t slot, float tBest) {
+          return intersectAABB(ray, inv, m_primBounds[slot], tBest);
+        });
+        if (best.hit()) {
+          best.primitive = m_indices[best.primitive];
+        }
+        return best;
+      }
+
+      /*
+        *  @brief Closest triangle hit by a ray, for a hierarchy made with buildTriangles over the
+        *  same vertex array.
+      */
+      inline RayHit raycastTriangles(const Ray& ray, const Vectors::Vector3* vertices, float tMax) const {
+        return raycast(ray, tMax, [&](uint32_t primitive, float tBest) {
+          return intersectTriangle(ray, vertices[3 * primitive], vertices[3 * primitive + 1],
+                                   vertices[3 * primitive + 2], tBest);
+        });
+      }
+
+      /*
+        *  @brief Calls fn(uint32_t primitive) for every primitive whose bounds overlap box.
+        *  @return Number of overlapping primitives.
+      */
+      template <typename Fn>
+      inline size_t queryAABB(const AABB& box, Fn&& fn) const {
+        if (m_nodes.empty() || !m_nodes[0].bounds.intersects(box)) {
+          return 0;
+        }
+        size_t hits = 0;
+        uint32_t stack[STACK_SIZE];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+          const BVHNode& current = m_nodes[stack[--top]];
+          if (current.isLeaf()) {
+            for (uint32_t i = current.leftFirst; i < current.leftFirst + current.count; ++i) {
+              if (m_primBounds[i].intersects(box)) {
+                fn(m_indices[i]);
+                ++hits;
+              }
+            }
+            continue;
+          }
+          uint32_t left = current.leftFirst;
+          if (m_nodes[left + 1].bounds.intersects(box)) {
+            stack[top++] = left + 1;
+          }
+          if (m_nodes[left].bounds.intersects(box)) {
+            stack[top++] = left;
+          }
+        }
+        return hits;
+      }
+
+      /*
+        *  @brief Appends the indices of all primitives overlapping box to out.
+        *  @return Number of indices appended.
+      */
+      inline size_t queryAABB(const AABB& box, std::vector<uint32_t>& out) const {
+        return queryAABB(box, [&out](uint32_t primitive) { out.push_back(primitive); });
+      }
+
+    private:
+      /*
+        *  @brief Closest-hit traversal; intersect and the returned primitive use leaf slot indices.
+      */
+      template <typename Fn>
+      inline RayHit raycastSlots(const Ray& ray, const Vectors::Vector3& inv, float tMax, Fn&& intersect) const {
+        RayHit best = { tMax, INVALID_INDEX };
+        const float INF = RAY_MISS;
+        if (m_nodes.empty() || intersectAABB(ray, inv, m_nodes[0].bounds, best.t) == INF) {
+          return best;
+        }
+
+        uint32_t stack[STACK_SIZE];
+        int top = 0;
+        uint32_t node = 0;
+        for (;;) {
+          const BVHNode& current = m_nodes[node];
+          if (current.isLeaf()) {
+            for (uint32_t i = current.leftFirst; i < current.leftFirst + current.count; ++i) {
+              if (intersectAABB(ray, inv, m_primBounds[i], best.t) == INF) {
+                continue;
+              }
+              float t = intersect(i, best.t);
+              if (t < best.t) {
+                best.t = t;
+                best.primitive = i;
+              }
+            }
+          }
+          else {
+            uint32_t left = current.leftFirst;
+            float tLeft = intersectAABB(ray, inv, m_nodes[left].bounds, best.t);
+            float tRight = intersectAABB(ray, inv, m_nodes[left + 1].bounds, best.t);
+            uint32_t nearNode = left, farNode = left + 1;
+            if (tRight < tLeft) {
+              std::swap(tLeft, tRight);
+              std::swap(nearNode, farNode);
+            }
+            if (tLeft != INF) {
+              if (tRight != INF) {
+                stack[top++] = farNode;
+              }
+              node = nearNode;
+              continue;
+            }
+          }
+          // Pop the next subtree that can still beat the closest hit.
+          for (;;) {
+            if (top == 0) {
+              return best;
+            }
+            node = stack[--top];
+            if (intersectAABB(ray, inv, m_nodes[node].bounds, best.t) != INF) {
+              break;
+            }
+          }
+        }
+      }
+
+      struct BuildPrimitive {
+        AABB bounds;
+        Vectors::Vector3 centroid;
+        uint32_t index;
+      };
+
+      /*
+        *  @brief Bounds of the primitives and of their centroids falling in one SAH bin.
+        *  Primitive bounds are kept as min (x, y, z, -) and max (-, x, y, z): the lanes of the two
+        *  4-wide loads of a packed AABB at min.x and min.z, so growing a bin takes one min and one
+        *  max per box. Centroid bounds use (x, y, z, -) for both. Lane "-" is never read.
+      */
+      struct Bin {
+        float lo[4];
+        float hi[4];
+        float centroidLo[4];
+        float centroidHi[4];
+        uint32_t count;
+
+        inline void clear() {
+          for (int i = 0; i < 4; ++i) {
+            lo[i] = centroidLo[i] = std::numeric_limits<float>::max();
+            hi[i] = centroidHi[i] = -std::numeric_limits<float>::max();
+          }
+          count = 0;
+        }
+
+        inline void grow(const BuildPrimitive& primitive) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          SIMD::storeu4(lo, SIMD::min4(SIMD::loadu4(lo), SIMD::loadu4(&primitive.bounds.min.x)));
+          SIMD::storeu4(hi, SIMD::max4(SIMD::loadu4(hi), SIMD::loadu4(&primitive.bounds.min.z)));
+          SIMD::float4 c = SIMD::loadu4(&primitive.centroid.x);
+          SIMD::storeu4(centroidLo, SIMD::min4(SIMD::loadu4(centroidLo), c));
+          SIMD::storeu4(centroidHi, SIMD::max4(SIMD::loadu4(centroidHi), c));
+#else
+          const float* boxMin = &primitive.bounds.min.x;
+          const float* boxMax = &primitive.bounds.max.x;
+          const float* c = &primitive.centroid.x;
+          for (int i = 0; i < 3; ++i) {
+            lo[i] = Math::EMin(lo[i], boxMin[i]);
+            hi[i + 1] = Math::EMax(hi[i + 1], boxMax[i]);
+            centroidLo[i] = Math::EMin(centroidLo[i], c[i]);
+            centroidHi[i] = Math::EMax(centroidHi[i], c[i]);
+          }
+#endif
+          ++count;
+        }
+
+        inline void merge(const Bin& other) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          SIMD::storeu4(lo, SIMD::min4(SIMD::loadu4(lo), SIMD::loadu4(other.lo)));
+          SIMD::storeu4(hi, SIMD::max4(SIMD::loadu4(hi), SIMD::loadu4(other.hi)));
+          SIMD::storeu4(centroidLo, SIMD::min4(SIMD::loadu4(centroidLo), SIMD::loadu4(other.centroidLo)));
+          SIMD::storeu4(centroidHi, SIMD::max4(SIMD::loadu4(centroidHi), SIMD::loadu4(other.centroidHi)));
+#else
+          for (int i = 0; i < 4; ++i) {
+            lo[i] = Math::EMin(lo[i], other.lo[i]);
+            hi[i] = Math::EMax(hi[i], other.hi[i]);
+            centroidLo[i] = Math::EMin(centroidLo[i], other.centroidLo[i]);
+            centroidHi[i] = Math::EMax(centroidHi[i], other.centroidHi[i]);
+          }
+#endif
+          count += other.count;
+        }
+
+        inline float surfaceArea() const {
+          float dx = hi[1] - lo[0], dy = hi[2] - lo[1], dz = hi[3] - lo[2];
+          return (dx < 0.0f || dy < 0.0f || dz < 0.0f) ? 0.0f : 2.0f * (dx * dy + dy * dz + dz * dx);
+        }
+
+        inline AABB bounds() const {
+          return AABB(Vectors::Vector3(lo[0], lo[1], lo[2]), Vectors::Vector3(hi[1], hi[2], hi[3]));
+        }
+
+        inline AABB centroidBounds() const {
+          return AABB(Vectors::Vector3(centroidLo[0], centroidLo[1], centroidLo[2]),
+                      Vectors::Vector3(centroidHi[0], centroidHi[1], centroidHi[2]));
+        }
+      };
+
+      struct Bins {
+        Bin bins[3][BIN_COUNT];
+
+        inline void clear(int binCount) {
+          for (int axis = 0; axis < 3; ++axis) {
+            for (int b = 0; b < binCount; ++b) {
+              bins[axis][b].clear();
+            }
+          }
+        }
+      };
+
+      static inline float component(const Vectors::Vector3& v, int axis) {
+        return (&v.x)[axis];
+      }
+
+      static inline int binOf(float value, float minValue, float scale, int binCount) {
+        int b = static_cast<int>((value - minValue) * scale);
+        return b < 0 ? 0 : (b >= binCount ? binCount - 1 : b);
+      }
+
+      /*
+        *  @brief Runs fn(begin, end) over [first, first + count), split across threads for large ranges.
+        *  Each range merges its partial result under lock, so callers accumulate locally first.
+      */
+      template <typename Fn>
+      static inline void forRange(uint32_t first, uint32_t count, Fn&& fn) {
+        size_t minChunk = count >= PARALLEL_BUILD_THRESHOLD ? PARALLEL_BUILD_THRESHOLD / 4 : count;
+        Parallel::parallelFor(first, static_cast<size_t>(first) + count, minChunk, fn);
+      }
+
+      /*
+        *  @brief Bounds and centroid bounds of work[first, first + count).
+      */
+      static inline Bin measure(const std::vector<BuildPrimitive>& work, uint32_t first, uint32_t count) {
+        Bin total;
+        total.clear();
+        std::mutex lock;
+        forRange(first, count, [&](size_t begin, size_t end) {
+          Bin local;
+          local.clear();
+          for (size_t i = begin; i < end; ++i) {
+            local.grow(work[i]);
+          }
+          std::lock_guard<std::mutex> guard(lock);
+          total.merge(local);
+        });
+        return total;
+      }
+
+      /*
+        *  @brief Builds the subtree of primitives [first, first + count) into scratch[nodeIndex].
+        *  The caller passes the bounds and centroid bounds of the range (the parent already has
+        *  them from its bins). A subtree of n primitives needs at most 2n - 2 descendant slots,
+        *  so each child gets a fixed region starting at childBase and parallel builds never
+        *  contend for slots.
+      */
+      inline void buildNode(std::vector<BuildPrimitive>& work, std::vector<BVHNode>& scratch, uint32_t nodeIndex,
+                            uint32_t first, uint32_t count, uint32_t childBase, int depth, const Bin& range) {
+        BVHNode& node = scratch[nodeIndex];
+        node.bounds = range.bounds();
+        if (count <= 2) {
+          makeLeaf(node, first, count);
+          return;
+        }
+
+        // Small nodes use fewer bins: the sweep, not the binning, dominates their cost.
+        const int binCount = count >= 2 * BIN_COUNT ? BIN_COUNT : (count / 2 > 4 ? static_cast<int>(count / 2) : 4);
+        AABB centroidBounds = range.centroidBounds();
+        Vectors::Vector3 extent = centroidBounds.size();
+        float scale[3];
+        for (int axis = 0; axis < 3; ++axis) {
+          float e = component(extent, axis);
+          scale[axis] = e > 0.0f ? binCount / e : 0.0f;
+        }
+
+        int bestAxis = -1;
+        int bestSplit = 0;
+        float bestCost = std::numeric_limits<float>::max();
+        Bins bins;
+        if (depth < MAX_SAH_DEPTH) {
+          bins.clear(binCount);
+          auto binRange = [&](size_t begin, size_t end, Bins& target) {
+            for (size_t i = begin; i < end; ++i) {
+              for (int axis = 0; axis < 3; ++axis) {
+                int b = binOf(component(work[i].centroid, axis), component(centroidBounds.min, axis), scale[axis],
+                              binCount);
+                target.bins[axis][b].grow(work[i]);
+              }
+            }
+          };
+          if (count < PARALLEL_BUILD_THRESHOLD) {
+            binRange(first, first + count, bins);
+          }
+          else {
+            std::mutex lock;
+            forRange(first, count, [&](size_t begin, size_t end) {
+              Bins local;
+              local.clear(binCount);
+              binRange(begin, end, local);
+              std::lock_guard<std::mutex> guard(lock);
+              for (int axis = 0; axis < 3; ++axis) {
+                for (int b = 0; b < binCount; ++b) {
+                  bins.bins[axis][b].merge(local.bins[axis][b]);
+                }
+              }
+            });
+          }
+
+          // Sweep the split planes: SAH cost = area(left) * count(left) + area(right) * count(right).
+          for (int axis = 0; axis < 3; ++axis) {
+            if (scale[axis] == 0.0f) {
+              continue;
+            }
+            float rightCost[BIN_COUNT];
+            Bin right;
+            right.clear();
+            for (int b = binCount - 1; b > 0; --b) {
+              right.merge(bins.bins[axis][b]);
+              rightCost[b] = right.surfaceArea() * static_cast<float>(right.count);
+            }
+            Bin left;
+            left.clear();
+            for (int b = 0; b < binCount - 1; ++b) {
+              left.merge(bins.bins[axis][b]);
+              if (left.count == 0 || left.count == count) {
+                continue;
+              }
+              float cost = left.surfaceArea() * static_cast<float>(left.count) + rightCost[b + 1];
+              if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = b;
+              }
+            }
+          }
+        }
+
+        uint32_t leftCount = 0;
+        Bin leftRange, rightRange;
+        if (bestAxis >= 0) {
+          // Traversal cost of one node ~ one primitive test, both relative to the parent area.
+          float area = range.surfaceArea();
+          float splitCost = 1.0f + (area > 0.0f ? bestCost / area : 0.0f);
+          if (splitCost >= static_cast<float>(count) && count <= MAX_LEAF_SIZE) {
+            makeLeaf(node, first, count);
+            return;
+          }
+          float minValue = component(centroidBounds.min, bestAxis);
+          float axisScale = scale[bestAxis];
+          BuildPrimitive* middle = std::partition(work.data() + first, work.data() + first + count,
+            [&](const BuildPrimitive& primitive) {
+              return binOf(component(primitive.centroid, bestAxis), minValue, axisScale, binCount) <= bestSplit;
+            });
+          leftCount = static_cast<uint32_t>(middle - (work.data() + first));
+          leftRange.clear();
+          rightRange.clear();
+          for (int b = 0; b < binCount; ++b) {
+            (b <= bestSplit ? leftRange : rightRange).merge(bins.bins[bestAxis][b]);
+          }
+        }
+        else if (count <= MAX_LEAF_SIZE) {
+          makeLeaf(node, first, count);
+          return;
+        }
+
+        if (leftCount == 0 || leftCount == count) {
+          // No usable SAH split (coincident centroids or depth limit): median along the widest axis.
+          int axis = extent.x >= extent.y ? (extent.x >= extent.z ? 0 : 2) : (extent.y >= extent.z ? 1 : 2);
+          leftCount = count / 2;
+          std::nth_element(work.data() + first, work.data() + first + leftCount, work.data() + first + count,
+            [&](const BuildPrimitive& a, const BuildPrimitive& b) {
+              return component(a.centroid, axis) < component(b.centroid, axis);
+            });
+          leftRange = measure(work, first, leftCount);
+          rightRange = measure(work, first + leftCount, count - leftCount);
+        }
+
+        uint32_t rightCount = count - leftCount;
+        node.leftFirst = childBase;
+        node.count = 0;
+        uint32_t leftBase = childBase + 2;
+        uint32_t rightBase = leftBase + 2 * leftCount - 2;
+        if (count >= PARALLEL_BUILD_THRESHOLD) {
+          Parallel::parallelFor(0, 2, 1, [&](size_t begin, size_t end) {
+            for (size_t child = begin; child < end; ++child) {
+              if (child == 0) {
+                buildNode(work, scratch, childBase, first, leftCount, leftBase, depth + 1, leftRange);
+              }
+              else {
+                buildNode(work, scratch, childBase + 1, first + leftCount, rightCount, rightBase, depth + 1, rightRange);
+              }
+            }
+          });
+        }
+        else {
+          buildNode(work, scratch, childBase, first, leftCount, leftBase, depth + 1, leftRange);
+          buildNode(work, scratch, childBase + 1, first + leftCount, rightCount, rightBase, depth + 1, rightRange);
+        }
+      }
+
+      static inline void makeLeaf(BVHNode& node, uint32_t first, uint32_t count) {
+        node.leftFirst = first;
+        node.count = count;
+      }
+
+      /*
+        *  @brief Copies the used scratch slots into m_nodes in depth-first order, keeping siblings adjacent.
+      */
+      inline void compact(const std::vector<BVHNode>& scratch) {
+        m_nodes.clear();
+        m_nodes.push_back(scratch[0]);
+        // Pairs of (scratch index, m_nodes index) whose children still need copying.
+        std::vector<uint32_t> pending;
+        pending.push_back(0);
+        pending.push_back(0);
+        while (!pending.empty()) {
+          uint32_t target = pending.back();
+          pending.pop_back();
+          uint32_t source = pending.back();
+          pending.pop_back();
+          const BVHNode& node = scratch[source];
+          if (node.isLeaf()) {
+            continue;
+          }
+          uint32_t left = static_cast<uint32_t>(m_nodes.size());
+          m_nodes.push_back(scratch[node.leftFirst]);
+          m_nodes.push_back(scratch[node.leftFirst + 1]);
+          m_nodes[target].leftFirst = left;
+          pending.push_back(node.leftFirst + 1);
+          pending.push_back(left + 1);
+          pending.push_back(node.leftFirst);
+          pending.push_back(left);
+        }
+      }
+
+      std::vector<BVHNode> m_nodes;
+      std::vector<uint32_t> m_indices;
+      std::vector<AABB> m_primBounds;
+    };
+
+  }
+}
@@ -0,0 +1,938 @@
+/*
+ *  @brief Micro-benchmark suite for every EngineUtilities math primitive.
+ *  Reports ns/op and ops/sec as JSON, optionally next to <cmath>/std baselines.
+ *
+ *  Build (Linux):  g++ -O2 -std=c++17 -pthread Benchmark.cpp -o engine_bench
+ *  Usage:          engine_bench [--baseline] [--filter=<substring>] [--min-time=<ms>] [--out=<file.json>]
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "EngineUtilites.h"
+
+using namespace EngineUtilities;
+using Vectors::Vector2;
+using Vectors::Vector3;
+using Vectors::Vector3SoA;
+using Vectors::Vector4;
+using Matriz::Matriz2x2;
+using Matriz::Matriz3x3;
+using Matrices::Matriz4x4;
+using Rotations::Quaternion;
+using Transforms::Transform;
+using Geometry::AABB;
+using Geometry::Ray;
+
+namespace {
+
+/*
+ *  @brief Keeps the compiler from discarding a benchmarked result.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/*
+ *  @brief Size of the rotating input tables (power of two, fits in L1).
+ */
+const size_t INPUT_COUNT = 1024;
+const size_t INPUT_MASK = INPUT_COUNT - 1;
+
+/*
+ *  @brief Elements per call for the array (batch) benchmarks.
+ */
+const size_t BATCH_COUNT = 4096;
+
+/*
+ *  @brief Command line options.
+ */
+struct Options {
+  bool baseline = false;
+  std::string filter;
+  double minTimeMs = 50.0;
+  std::string outPath;
+};
+
+/*
+ *  @brief One measured benchmark, optionally paired with a std baseline.
+ */
+struct Result {
+  std::string name;
+  std::string group;
+  size_t iterations = 0;
+  double nsPerOp = 0.0;
+  std::string baselineName;
+  double baselineNsPerOp = 0.0;
+};
+
+/*
+ *  @brief Deterministic pseudo-random input tables shared by all benchmarks.
+ */
+struct Inputs {
+  std::vector<float> angles, unit, positive, any, small;
+  std::vector<int> exponents, smallInts;
+  std::vector<Vector2> v2a, v2b;
+  std::vector<Vector3> v3a, v3b;
+  std::vector<Vector4> v4a, v4b;
+  std::vector<Matriz2x2> m2a, m2b;
+  std::vector<Matriz3x3> m3a, m3b;
+  std::vector<Matriz4x4> m4a, m4b, m4affine;
+  std::vector<Quaternion> qa, qb;
+
+  Inputs() {
+    unsigned state = 12345u;
+    auto next = [&state]() {
+      state = state * 1664525u + 1013904223u;
+      return (state >> 8) * (1.0f / 16777216.0f);
+    };
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      angles.push_back((next() * 2.0f - 1.0f) * 10.0f);
+      unit.push_back(next() * 1.98f - 0.99f);
+      positive.push_back(next() * 1000.0f + 0.001f);
+      any.push_back((next() * 2.0f - 1.0f) * 100.0f);
+      small.push_back(next() * 4.0f - 2.0f);
+      exponents.push_back(static_cast<int>(next() * 16.0f) - 8);
+      smallInts.push_back(static_cast<int>(next() * 20.0f));
+
+      v2a.push_back(Vector2(any.back(), small.back() + 3.0f));
+      v2b.push_back(Vector2(next() * 5.0f, next() * 5.0f + 1.0f));
+      v3a.push_back(Vector3(next() * 10.0f - 5.0f, next() * 10.0f - 5.0f, next() * 10.0f + 1.0f));
+      v3b.push_back(Vector3(next() * 10.0f - 5.0f, next() * 10.0f + 1.0f, next() * 10.0f - 5.0f));
+      v4a.push_back(Vector4(next(), next() + 1.0f, next(), next()));
+      v4b.push_back(Vector4(next(), next(), next() + 1.0f, next()));
+
+      m2a.push_back(Matriz2x2(next() + 1.0f, next(), next(), next() + 1.0f));
+      m2b.push_back(Matriz2x2(next() + 1.0f, next(), next(), next() + 1.0f));
+      m3a.push_back(Matriz3x3(next() + 2.0f, next(), next(), next(), next() + 2.0f, next(), next(), next(), next() + 2.0f));
+      m3b.push_back(Matriz3x3(next() + 2.0f, next(), next(), next(), next() + 2.0f, next(), next(), next(), next() + 2.0f));
+
+      Vector3 axis = Vector3(next() - 0.5f, next() - 0.5f, next() + 0.1f).normalized();
+      qa.push_back(Quaternion(axis, angles.back()));
+      qb.push_back(Quaternion(Vector3(next() + 0.1f, next() - 0.5f, next() - 0.5f).normalized(), next() * 6.0f));
+
+      Matriz4x4 general;
+      for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+          general.m[c][r] = next() + (c == r ? 2.0f : 0.0f);
+        }
+      }
+      m4a.push_back(general);
+      m4b.push_back(qb.back().toMatrix4x4());
+      m4affine.push_back(Matriz4x4::createTranslation(v3a.back()) * qa.back().toMatrix4x4() *
+                         Matriz4x4::createScale(Vector3(1.0f + next(), 1.0f + next(), 1.0f + next())));
+    }
+  }
+};
+
+/*
+ *  @brief Runs fn(i) in a loop, doubling the iteration count until minTimeMs is reached.
+ *  @return Nanoseconds per call and the final iteration count.
+ */
+template <typename Fn>
+double measure(Fn&& fn, double minTimeMs, size_t& iterations) {
+  using Clock = std::chrono::steady_clock;
+  for (size_t i = 0; i < INPUT_COUNT; ++i) {
+    doNotOptimize(fn(i & INPUT_MASK));
+  }
+  size_t n = 1024;
+  for (;;) {
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < n; ++i) {
+      doNotOptimize(fn(i & INPUT_MASK));
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (ns >= minTimeMs * 1e6 || n >= (size_t(1) << 34)) {
+      iterations = n;
+      return ns / static_cast<double>(n);
+    }
+    n *= (ns < minTimeMs * 1e5) ? 8 : 2;
+  }
+}
+
+/*
+ *  @brief Collects results and applies the command line filter.
+ */
+class Suite {
+public:
+  explicit Suite(const Options& options) : m_options(options) {}
+
+  /*
+   *  @brief Benchmarks one call per iteration.
+   */
+  template <typename Fn>
+  void run(const char* group, const char* name, Fn&& fn) {
+    runScaled(group, name, 1, fn, nullptr, static_cast<NoBaseline*>(nullptr));
+  }
+
+  /*
+   *  @brief Benchmarks fn and, with --baseline, the equivalent std expression.
+   */
+  template <typename Fn, typename BaseFn>
+  void runVs(const char* group, const char* name, Fn&& fn, const char* baseName, BaseFn&& baseFn) {
+    runScaled(group, name, 1, fn, baseName, &baseFn);
+  }
+
+  /*
+   *  @brief Benchmarks a call that processes opsPerCall elements; reports per element.
+   */
+  template <typename Fn>
+  void runBatch(const char* group, const char* name, size_t opsPerCall, Fn&& fn) {
+    runScaled(group, name, opsPerCall, fn, nullptr, static_cast<NoBaseline*>(nullptr));
+  }
+
+  template <typename Fn, typename BaseFn>
+  void runBatchVs(const char* group, const char* name, size_t opsPerCall, Fn&& fn,
+                  const char* baseName, BaseFn&& baseFn) {
+    runScaled(group, name, opsPerCall, fn, baseName, &baseFn);
+  }
+
+  /*
+   *  @brief Writes all results as a JSON document.
+   */
+  void writeJson(std::ostream& os) const {
+    std::time_t now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    os << "{\n  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"num_cpus\": " << Parallel::workerCount() << ",\n";
+    os << "    \"simd\": \"" << simdName() << "\",\n";
+    os << "    \"min_time_ms\": " << m_options.minTimeMs << "\n";
+    os << "  },\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < m_results.size(); ++i) {
+      const Result& r = m_results[i];
+      os << "    {\"name\": \"" << escape(r.name) << "\", \"group\": \"" << r.group << "\""
+         << ", \"iterations\": " << r.iterations
+         << ", \"ns_per_op\": " << r.nsPerOp
+         << ", \"ops_per_sec\": " << (r.nsPerOp > 0.0 ? 1e9 / r.nsPerOp : 0.0);
+      if (!r.baselineName.empty()) {
+        os << ", \"baseline\": \"" << escape(r.baselineName) << "\""
+           << ", \"baseline_ns_per_op\": " << r.baselineNsPerOp
+           << ", \"speedup\": " << (r.nsPerOp > 0.0 ? r.baselineNsPerOp / r.nsPerOp : 0.0);
+      }
+      os << "}" << (i + 1 < m_results.size() ? "," : "") << "\n";
+    }
+    os << "  ]\n}\n";
+  }
+
+private:
+  struct NoBaseline {
+    int operator()(size_t) const { return 0; }
+  };
+
+  template <typename Fn, typename BaseFn = NoBaseline>
+  void runScaled(const char* group, const char* name, size_t opsPerCall, Fn& fn,
+                 const char* baseName, BaseFn* baseFn) {
+    std::string fullName = std::string(group) + "::" + name;
+    if (!m_options.filter.empty() && fullName.find(m_options.filter) == std::string::npos) {
+      return;
+    }
+    Result r;
+    r.name = fullName;
+    r.group = group;
+    r.nsPerOp = measure(fn, m_options.minTimeMs, r.iterations) / static_cast<double>(opsPerCall);
+    if (m_options.baseline && baseName && baseFn) {
+      size_t baseIterations = 0;
+      r.baselineName = baseName;
+      r.baselineNsPerOp = measure(*baseFn, m_options.minTimeMs, baseIterations) / static_cast<double>(opsPerCall);
+    }
+    std::cerr << fullName << ": " << r.nsPerOp << " ns/op\n";
+    m_results.push_back(r);
+  }
+
+  static const char* simdName() {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+    return SIMD::hasAVX2() ? "sse2+avx2" : "sse2";
+#elif defined(ENGINEUTILITIES_SIMD_SSE2)
+    return "sse2";
+#elif defined(ENGINEUTILITIES_SIMD_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+  }
+
+  static std::string escape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+      if (c == '"' || c == '\\') out += '\\';
+      out += c;
+    }
+    return out;
+  }
+
+  Options m_options;
+  std::vector<Result> m_results;
+};
+
+void benchMath(Suite& s, const Inputs& in) {
+  s.runVs("Math", "abs", [&](size_t i) { return Math::abs(in.any[i]); },
+          "std::fabs", [&](size_t i) { return std::fabs(in.any[i]); });
+  s.run("Math", "approxEqual", [&](size_t i) { return Math::approxEqual(in.any[i], in.small[i]); });
+  s.runVs("Math", "EMax", [&](size_t i) { return Math::EMax(in.any[i], in.small[i]); },
+          "std::fmax", [&](size_t i) { return std::fmax(in.any[i], in.small[i]); });
+  s.runVs("Math", "EMin", [&](size_t i) { return Math::EMin(in.any[i], in.small[i]); },
+          "std::fmin", [&](size_t i) { return std::fmin(in.any[i], in.small[i]); });
+  s.runVs("Math", "power", [&](size_t i) { return Math::power(in.small[i], in.exponents[i]); },
+          "std::pow", [&](size_t i) { return std::pow(in.small[i], static_cast<float>(in.exponents[i])); });
+  s.run("Math", "factorial", [&](size_t i) { return Math::factorial(in.smallInts[i]); });
+  s.runVs("Math", "floor", [&](size_t i) { return Math::floor(in.any[i]); },
+          "std::floor", [&](size_t i) { return std::floor(in.any[i]); });
+  s.runVs("Math", "ceil", [&](size_t i) { return Math::ceil(in.any[i]); },
+          "std::ceil", [&](size_t i) { return std::ceil(in.any[i]); });
+  s.runVs("Math", "round", [&](size_t i) { return Math::round(in.any[i]); },
+          "std::round", [&](size_t i) { return std::round(in.any[i]); });
+  s.runVs("Math", "normalizeAngle", [&](size_t i) { return Math::normalizeAngle(in.angles[i]); },
+          "std::remainder", [&](size_t i) { return std::remainder(in.angles[i], Math::TWO_PI); });
+  s.runVs("Math", "sin", [&](size_t i) { return Math::sin(in.angles[i]); },
+          "std::sin", [&](size_t i) { return std::sin(in.angles[i]); });
+  s.runVs("Math", "sin(Fast)", [&](size_t i) { return Math::sin(in.angles[i], Math::TrigAccuracy::Fast); },
+          "std::sin", [&](size_t i) { return std::sin(in.angles[i]); });
+  s.runVs("Math", "cos", [&](size_t i) { return Math::cos(in.angles[i]); },
+          "std::cos", [&](size_t i) { return std::cos(in.angles[i]); });
+  s.runVs("Math", "cos(Fast)", [&](size_t i) { return Math::cos(in.angles[i], Math::TrigAccuracy::Fast); },
+          "std::cos", [&](size_t i) { return std::cos(in.angles[i]); });
+  s.runVs("Math", "sincos", [&](size_t i) { float sv, cv; Math::sincos(in.angles[i], &sv, &cv); return sv + cv; },
+          "std::sin+std::cos", [&](size_t i) { return std::sin(in.angles[i]) + std::cos(in.angles[i]); });
+  s.runVs("Math", "sqrt", [&](size_t i) { return Math::sqrt(in.positive[i]); },
+          "std::sqrt", [&](size_t i) { return std::sqrt(in.positive[i]); });
+  s.runVs("Math", "rsqrt", [&](size_t i) { return Math::rsqrt(in.positive[i]); },
+          "1/std::sqrt", [&](size_t i) { return 1.0f / std::sqrt(in.positive[i]); });
+  s.runVs("Math", "atan", [&](size_t i) { return Math::atan(in.any[i]); },
+          "std::atan", [&](size_t i) { return std::atan(in.any[i]); });
+  s.runVs("Math", "atan2", [&](size_t i) { return Math::atan2(in.any[i], in.small[i]); },
+          "std::atan2", [&](size_t i) { return std::atan2(in.any[i], in.small[i]); });
+  s.runVs("Math", "asin", [&](size_t i) { return Math::asin(in.unit[i]); },
+          "std::asin", [&](size_t i) { return std::asin(in.unit[i]); });
+  s.runVs("Math", "acos", [&](size_t i) { return Math::acos(in.unit[i]); },
+          "std::acos", [&](size_t i) { return std::acos(in.unit[i]); });
+  s.run("Math", "radians", [&](size_t i) { return Math::radians(in.any[i]); });
+  s.run("Math", "degrees", [&](size_t i) { return Math::degrees(in.any[i]); });
+
+  static std::vector<float> angles(BATCH_COUNT), ys(BATCH_COUNT), xs(BATCH_COUNT), out(BATCH_COUNT), out2(BATCH_COUNT);
+  for (size_t i = 0; i < BATCH_COUNT; ++i) {
+    angles[i] = in.angles[i & INPUT_MASK];
+    ys[i] = in.any[i & INPUT_MASK];
+    xs[i] = in.small[i & INPUT_MASK];
+  }
+  s.runBatchVs("Math", "sin_n", BATCH_COUNT,
+               [&](size_t) { Math::sin_n(angles.data(), out.data(), BATCH_COUNT); return out[0]; },
+               "std::sin loop", [&](size_t) {
+                 for (size_t k = 0; k < BATCH_COUNT; ++k) out[k] = std::sin(angles[k]);
+                 return out[0];
+               });
+  s.runBatchVs("Math", "cos_n", BATCH_COUNT,
+               [&](size_t) { Math::cos_n(angles.data(), out.data(), BATCH_COUNT); return out[0]; },
+               "std::cos loop", [&](size_t) {
+                 for (size_t k = 0; k < BATCH_COUNT; ++k) out[k] = std::cos(angles[k]);
+                 return out[0];
+               });
+  s.runBatch("Math", "sincos_n", BATCH_COUNT,
+             [&](size_t) { Math::sincos_n(angles.data(), out.data(), out2.data(), BATCH_COUNT); return out[0]; });
+  s.runBatchVs("Math", "atan2_n", BATCH_COUNT,
+               [&](size_t) { Math::atan2_n(ys.data(), xs.data(), out.data(), BATCH_COUNT); return out[0]; },
+               "std::atan2 loop", [&](size_t) {
+                 for (size_t k = 0; k < BATCH_COUNT; ++k) out[k] = std::atan2(ys[k], xs[k]);
+                 return out[0];
+               });
+}
+
+void benchVector2(Suite& s, const Inputs& in) {
+  s.run("Vector2", "operator+", [&](size_t i) { return in.v2a[i] + in.v2b[i]; });
+  s.run("Vector2", "operator-", [&](size_t i) { return in.v2a[i] - in.v2b[i]; });
+  s.run("Vector2", "operator*(float)", [&](size_t i) { return in.v2a[i] * in.small[i]; });
+  s.run("Vector2", "operator*(float, Vector2)", [&](size_t i) { return in.small[i] * in.v2a[i]; });
+  s.run("Vector2", "operator/(float)", [&](size_t i) { return in.v2a[i] / in.positive[i]; });
+  s.run("Vector2", "operator+=", [&](size_t i) { Vector2 v = in.v2a[i]; v += in.v2b[i]; return v; });
+  s.run("Vector2", "operator-=", [&](size_t i) { Vector2 v = in.v2a[i]; v -= in.v2b[i]; return v; });
+  s.run("Vector2", "operator*=", [&](size_t i) { Vector2 v = in.v2a[i]; v *= in.small[i]; return v; });
+  s.run("Vector2", "operator/=", [&](size_t i) { Vector2 v = in.v2a[i]; v /= in.positive[i]; return v; });
+  s.run("Vector2", "operator==", [&](size_t i) { return in.v2a[i] == in.v2b[i]; });
+  s.run("Vector2", "operator!=", [&](size_t i) { return in.v2a[i] != in.v2b[i]; });
+  s.run("Vector2", "dot", [&](size_t i) { return in.v2a[i].dot(in.v2b[i]); });
+  s.run("Vector2", "magnitude", [&](size_t i) { return in.v2a[i].magnitude(); });
+  s.run("Vector2", "squareMagnitude", [&](size_t i) { return in.v2a[i].squareMagnitude(); });
+  s.run("Vector2", "normalize", [&](size_t i) { Vector2 v = in.v2a[i]; return v.normalize(); });
+  s.run("Vector2", "normalized", [&](size_t i) { return in.v2a[i].normalized(); });
+  s.run("Vector2", "distance", [&](size_t i) { return in.v2a[i].distance(in.v2b[i]); });
+  s.run("Vector2", "squareDistance", [&](size_t i) { return in.v2a[i].squareDistance(in.v2b[i]); });
+}
+
+void benchVector3(Suite& s, const Inputs& in) {
+  s.run("Vector3", "operator+", [&](size_t i) { return in.v3a[i] + in.v3b[i]; });
+  s.run("Vector3", "operator-", [&](size_t i) { return in.v3a[i] - in.v3b[i]; });
+  s.run("Vector3", "operator*(float)", [&](size_t i) { return in.v3a[i] * in.small[i]; });
+  s.run("Vector3", "operator*(float, Vector3)", [&](size_t i) { return in.small[i] * in.v3a[i]; });
+  s.run("Vector3", "operator/(float)", [&](size_t i) { return in.v3a[i] / in.positive[i]; });
+  s.run("Vector3", "operator+=", [&](size_t i) { Vector3 v = in.v3a[i]; v += in.v3b[i]; return v; });
+  s.run("Vector3", "operator-=", [&](size_t i) { Vector3 v = in.v3a[i]; v -= in.v3b[i]; return v; });
+  s.run("Vector3", "operator*=", [&](size_t i) { Vector3 v = in.v3a[i]; v *= in.small[i]; return v; });
+  s.run("Vector3", "operator/=", [&](size_t i) { Vector3 v = in.v3a[i]; v /= in.positive[i]; return v; });
+  s.run("Vector3", "operator==", [&](size_t i) { return in.v3a[i] == in.v3b[i]; });
+  s.run("Vector3", "operator!=", [&](size_t i) { return in.v3a[i] != in.v3b[i]; });
+  s.run("Vector3", "dot", [&](size_t i) { return in.v3a[i].dot(in.v3b[i]); });
+  s.run("Vector3", "cross", [&](size_t i) { return in.v3a[i].cross(in.v3b[i]); });
+  s.run("Vector3", "magnitude", [&](size_t i) { return in.v3a[i].magnitude(); });
+  s.run("Vector3", "squareMagnitude", [&](size_t i) { return in.v3a[i].squareMagnitude(); });
+  s.run("Vector3", "normalize", [&](size_t i) { Vector3 v = in.v3a[i]; return v.normalize(); });
+  s.run("Vector3", "normalized", [&](size_t i) { return in.v3a[i].normalized(); });
+  s.run("Vector3", "distance", [&](size_t i) { return in.v3a[i].distance(in.v3b[i]); });
+  s.runVs("Vector3", "distanceLessThan", [&](size_t i) { return in.v3a[i].distanceLessThan(in.v3b[i], 5.0f); },
+          "distance < r", [&](size_t i) { return in.v3a[i].distance(in.v3b[i]) < 5.0f; });
+
+  static Vector3SoA a(in.v3a), b(in.v3b), c;
+  static std::vector<float> out(INPUT_COUNT);
+  s.runBatch("Vector3SoA", "add", INPUT_COUNT, [&](size_t) { a.add(b); return a.x()[0]; });
+  s.runBatch("Vector3SoA", "scale", INPUT_COUNT, [&](size_t) { a.scale(0.999f); return a.x()[0]; });
+  s.runBatch("Vector3SoA", "dot", INPUT_COUNT, [&](size_t) { a.dot(b, out.data()); return out[0]; });
+  s.runBatch("Vector3SoA", "cross", INPUT_COUNT, [&](size_t) { a.cross(b, c); return c.x()[0]; });
+  s.runBatch("Vector3SoA", "normalize", INPUT_COUNT, [&](size_t) { a.normalize(); return a.x()[0]; });
+  s.runBatch("Vector3SoA", "lengthSq", INPUT_COUNT, [&](size_t) { a.lengthSq(out.data()); return out[0]; });
+  s.runBatch("Vector3SoA", "distance", INPUT_COUNT, [&](size_t) { a.distance(b, out.data()); return out[0]; });
+
+  static std::vector<unsigned char> within(INPUT_COUNT);
+  s.runBatchVs("Vector3", "squareDistanceBatch", INPUT_COUNT,
+               [&](size_t i) { Vectors::squareDistanceBatch(in.v3b[i], in.v3a.data(), INPUT_COUNT, out.data()); return out[0]; },
+               "distance loop", [&](size_t i) {
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) out[k] = in.v3b[i].distance(in.v3a[k]);
+                 return out[0];
+               });
+  s.runBatchVs("Vector3", "distanceLessThanBatch", INPUT_COUNT,
+               [&](size_t i) { return Vectors::distanceLessThanBatch(in.v3b[i], 5.0f, in.v3a.data(), INPUT_COUNT, within.data()); },
+               "distance < r loop", [&](size_t i) {
+                 size_t count = 0;
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) {
+                   within[k] = in.v3b[i].distance(in.v3a[k]) < 5.0f;
+                   count += within[k];
+                 }
+                 return count;
+               });
+  s.runBatchVs("Vector3", "nearestOfBatch", INPUT_COUNT,
+               [&](size_t i) { return Vectors::nearestOfBatch(in.v3b[i], in.v3a.data(), INPUT_COUNT); },
+               "nearestOf", [&](size_t i) { return in.v3b[i].nearestOf(in.v3a.data(), INPUT_COUNT); });
+
+  static std::vector<Vector3> pos(in.v3a), vel(in.v3b);
+  s.runBatchVs("VectorExpr", "a + b * s - c", INPUT_COUNT,
+               [&](size_t) {
+                 Vectors::span(pos) = Vectors::lazy(pos) + Vectors::lazy(vel) * 0.5f - Vectors::lazy(in.v3a);
+                 return pos[0];
+               },
+               "Vector3 operator loop", [&](size_t) {
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) pos[k] = pos[k] + vel[k] * 0.5f - in.v3a[k];
+                 return pos[0];
+               });
+}
+
+void benchVector4(Suite& s, const Inputs& in) {
+  s.run("Vector4", "operator+", [&](size_t i) { return in.v4a[i] + in.v4b[i]; });
+  s.run("Vector4", "operator-", [&](size_t i) { return in.v4a[i] - in.v4b[i]; });
+  s.run("Vector4", "operator*(float)", [&](size_t i) { return in.v4a[i] * in.small[i]; });
+  s.run("Vector4", "operator*(float, Vector4)", [&](size_t i) { return in.small[i] * in.v4a[i]; });
+  s.run("Vector4", "operator/(float)", [&](size_t i) { return in.v4a[i] / in.positive[i]; });
+  s.run("Vector4", "operator+=", [&](size_t i) { Vector4 v = in.v4a[i]; v += in.v4b[i]; return v; });
+  s.run("Vector4", "operator-=", [&](size_t i) { Vector4 v = in.v4a[i]; v -= in.v4b[i]; return v; });
+  s.run("Vector4", "operator*=", [&](size_t i) { Vector4 v = in.v4a[i]; v *= in.small[i]; return v; });
+  s.run("Vector4", "operator/=", [&](size_t i) { Vector4 v = in.v4a[i]; v /= in.positive[i]; return v; });
+  s.run("Vector4", "operator==", [&](size_t i) { return in.v4a[i] == in.v4b[i]; });
+  s.run("Vector4", "operator!=", [&](size_t i) { return in.v4a[i] != in.v4b[i]; });
+  s.run("Vector4", "dot", [&](size_t i) { return in.v4a[i].dot(in.v4b[i]); });
+  s.run("Vector4", "magnitude", [&](size_t i) { return in.v4a[i].magnitude(); });
+  s.run("Vector4", "squareMagnitude", [&](size_t i) { return in.v4a[i].squareMagnitude(); });
+  s.run("Vector4", "normalize", [&](size_t i) { Vector4 v = in.v4a[i]; return v.normalize(); });
+  s.run("Vector4", "normalized", [&](size_t i) { return in.v4a[i].normalized(); });
+  s.run("Vector4", "distance", [&](size_t i) { return in.v4a[i].distance(in.v4b[i]); });
+  s.run("Vector4", "squareDistance", [&](size_t i) { return in.v4a[i].squareDistance(in.v4b[i]); });
+}
+
+void benchMatriz2x2(Suite& s, const Inputs& in) {
+  s.run("Matriz2x2", "operator==", [&](size_t i) { return in.m2a[i] == in.m2b[i]; });
+  s.run("Matriz2x2", "operator+", [&](size_t i) { return in.m2a[i] + in.m2b[i]; });
+  s.run("Matriz2x2", "operator-", [&](size_t i) { return in.m2a[i] - in.m2b[i]; });
+  s.run("Matriz2x2", "operator*(float)", [&](size_t i) { return in.m2a[i] * in.small[i]; });
+  s.run("Matriz2x2", "operator*(Matriz2x2)", [&](size_t i) { return in.m2a[i] * in.m2b[i]; });
+  s.run("Matriz2x2", "operator*(Vector2)", [&](size_t i) { return in.m2a[i] * in.v2a[i]; });
+  s.run("Matriz2x2", "operator+=", [&](size_t i) { Matriz2x2 m = in.m2a[i]; m += in.m2b[i]; return m; });
+  s.run("Matriz2x2", "operator-=", [&](size_t i) { Matriz2x2 m = in.m2a[i]; m -= in.m2b[i]; return m; });
+  s.run("Matriz2x2", "operator*=(float)", [&](size_t i) { Matriz2x2 m = in.m2a[i]; m *= in.small[i]; return m; });
+  s.run("Matriz2x2", "operator*=(Matriz2x2)", [&](size_t i) { Matriz2x2 m = in.m2a[i]; m *= in.m2b[i]; return m; });
+  s.run("Matriz2x2", "determinant", [&](size_t i) { return in.m2a[i].determinant(); });
+  s.run("Matriz2x2", "transposed", [&](size_t i) { return in.m2a[i].transposed(); });
+  s.run("Matriz2x2", "inverse", [&](size_t i) { return in.m2a[i].inverse(); });
+  s.run("Matriz2x2", "Rotation", [&](size_t i) { return Matriz2x2::Rotation(in.angles[i]); });
+  s.run("Matriz2x2", "Scale", [&](size_t i) { return Matriz2x2::Scale(in.v2a[i]); });
+}
+
+void benchMatriz3x3(Suite& s, const Inputs& in) {
+  s.run("Matriz3x3", "operator==", [&](size_t i) { return in.m3a[i] == in.m3b[i]; });
+  s.run("Matriz3x3", "operator+", [&](size_t i) { return in.m3a[i] + in.m3b[i]; });
+  s.run("Matriz3x3", "operator-", [&](size_t i) { return in.m3a[i] - in.m3b[i]; });
+  s.run("Matriz3x3", "operator*(float)", [&](size_t i) { return in.m3a[i] * in.small[i]; });
+  s.run("Matriz3x3", "operator*(Matriz3x3)", [&](size_t i) { return in.m3a[i] * in.m3b[i]; });
+  s.run("Matriz3x3", "operator*(Vector3)", [&](size_t i) { return in.m3a[i] * in.v3a[i]; });
+  s.run("Matriz3x3", "operator+=", [&](size_t i) { Matriz3x3 m = in.m3a[i]; m += in.m3b[i]; return m; });
+  s.run("Matriz3x3", "operator-=", [&](size_t i) { Matriz3x3 m = in.m3a[i]; m -= in.m3b[i]; return m; });
+  s.run("Matriz3x3", "operator*=(float)", [&](size_t i) { Matriz3x3 m = in.m3a[i]; m *= in.small[i]; return m; });
+  s.run("Matriz3x3", "operator*=(Matriz3x3)", [&](size_t i) { Matriz3x3 m = in.m3a[i]; m *= in.m3b[i]; return m; });
+  s.run("Matriz3x3", "cofactor", [&](size_t i) { return in.m3a[i].cofactor(static_cast<int>(i % 3), static_cast<int>((i / 3) % 3)); });
+  s.run("Matriz3x3", "determinant", [&](size_t i) { return in.m3a[i].determinant(); });
+  s.run("Matriz3x3", "transposed", [&](size_t i) { return in.m3a[i].transposed(); });
+  s.run("Matriz3x3", "adjugate", [&](size_t i) { return in.m3a[i].adjugate(); });
+  s.run("Matriz3x3", "inverse", [&](size_t i) { return in.m3a[i].inverse(); });
+  s.run("Matriz3x3", "inverseTransposed", [&](size_t i) { return in.m3a[i].inverseTransposed(); });
+  s.run("Matriz3x3", "RotationX", [&](size_t i) { return Matriz3x3::RotationX(in.angles[i]); });
+  s.run("Matriz3x3", "RotationY", [&](size_t i) { return Matriz3x3::RotationY(in.angles[i]); });
+  s.run("Matriz3x3", "RotationZ", [&](size_t i) { return Matriz3x3::RotationZ(in.angles[i]); });
+  s.run("Matriz3x3", "Scale", [&](size_t i) { return Matriz3x3::Scale(in.v3a[i]); });
+
+  static std::vector<Matriz3x3> out(INPUT_COUNT);
+  s.runBatch("Matriz3x3", "inverseBatch", INPUT_COUNT,
+             [&](size_t) { Matriz::inverseBatch(in.m3a.data(), out.data(), INPUT_COUNT); return out[0].m[0][0]; });
+}
+
+void benchMatriz4x4(Suite& s, const Inputs& in) {
+  s.run("Matriz4x4", "operator*(Matriz4x4)", [&](size_t i) { return in.m4a[i] * in.m4b[i]; });
+  s.run("Matriz4x4", "operator*(Vector3)", [&](size_t i) { return in.m4a[i] * in.v3a[i]; });
+  s.run("Matriz4x4", "createTranslation", [&](size_t i) { return Matriz4x4::createTranslation(in.v3a[i]); });
+  s.run("Matriz4x4", "createScale", [&](size_t i) { return Matriz4x4::createScale(in.v3a[i]); });
+  s.run("Matriz4x4", "getRotationMatriz3x3", [&](size_t i) { return in.m4a[i].getRotationMatriz3x3(); });
+  s.run("Matriz4x4", "transposed", [&](size_t i) { return in.m4a[i].transposed(); });
+  s.run("Matriz4x4", "determinant", [&](size_t i) { return in.m4a[i].determinant(); });
+  s.run("Matriz4x4", "inverse", [&](size_t i) { return in.m4a[i].inverse(); });
+  s.run("Matriz4x4", "inverseAffine", [&](size_t i) { return in.m4affine[i].inverseAffine(); });
+  s.run("Matriz4x4", "inverseOrthonormal", [&](size_t i) { return in.m4b[i].inverseOrthonormal(); });
+  s.run("Matriz4x4", "createPerspective", [&](size_t i) {
+    return Matriz4x4::createPerspective(0.5f + in.unit[i] * 0.25f, 1.5f, 0.1f, 100.0f);
+  });
+  s.run("Matriz4x4", "createLookAt", [&](size_t i) {
+    return Matriz4x4::createLookAt(in.v3a[i], in.v3b[i], Vector3(0.0f, 1.0f, 0.0f));
+  });
+  static std::vector<Matriz4x4> projections;
+  if (projections.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      projections.push_back(Matriz4x4::createPerspectiveInfiniteReversedZ(0.5f + in.unit[i] * 0.25f, 1.5f, 0.1f));
+    }
+  }
+  s.runVs("Matriz4x4", "inversePerspective", [&](size_t i) { return projections[i].inversePerspective(); },
+          "inverse", [&](size_t i) { return projections[i].inverse(); });
+
+  static std::vector<Matriz4x4> out(INPUT_COUNT);
+  static std::vector<Vector3> points(INPUT_COUNT);
+  s.runBatch("Matriz4x4", "multiplyBatch", INPUT_COUNT, [&](size_t) {
+    Matrices::multiplyBatch(in.m4a.data(), in.m4b.data(), out.data(), INPUT_COUNT);
+    return out[0].m[0][0];
+  });
+  s.runBatch("Matriz4x4", "transformPoints", INPUT_COUNT, [&](size_t i) {
+    Matrices::transformPoints(in.m4affine[i], in.v3a.data(), points.data(), INPUT_COUNT);
+    return points[0].x;
+  });
+}
+
+void benchQuaternion(Suite& s, const Inputs& in) {
+  s.run("Quaternion", "Quaternion(axis, angle)", [&](size_t i) { return Quaternion(in.v3a[i], in.angles[i]); });
+  s.run("Quaternion", "operator==", [&](size_t i) { return in.qa[i] == in.qb[i]; });
+  s.run("Quaternion", "operator*(Quaternion)", [&](size_t i) { return in.qa[i] * in.qb[i]; });
+  s.run("Quaternion", "operator*(float)", [&](size_t i) { return in.qa[i] * in.small[i]; });
+  s.run("Quaternion", "operator*(Vector3)", [&](size_t i) { return in.qa[i] * in.v3a[i]; });
+  s.run("Quaternion", "magnitude", [&](size_t i) { return in.qa[i].magnitude(); });
+  s.run("Quaternion", "normalize", [&](size_t i) { Quaternion q = in.qa[i] * 2.0f; return q.normalize(); });
+  s.run("Quaternion", "normalized", [&](size_t i) { return (in.qa[i] * 2.0f).normalized(); });
+  s.run("Quaternion", "conjugate", [&](size_t i) { return in.qa[i].conjugate(); });
+  s.run("Quaternion", "inverse", [&](size_t i) { return in.qa[i].inverse(); });
+  s.run("Quaternion", "Slerp", [&](size_t i) { return Quaternion::Slerp(in.qa[i], in.qb[i], in.unit[i] * 0.5f + 0.5f); });
+  s.run("Quaternion", "toMatrix4x4", [&](size_t i) { return in.qa[i].toMatrix4x4(); });
+  s.run("Quaternion", "fromMatrix4x4", [&](size_t i) { return Quaternion::fromMatrix4x4(in.m4b[i]); });
+  s.run("Quaternion", "toAxisAngle", [&](size_t i) {
+    Vector3 axis;
+    float angle;
+    in.qa[i].toAxisAngle(axis, angle);
+    return angle + axis.x;
+  });
+
+  static std::vector<Quaternion> qout(INPUT_COUNT), qscaled;
+  static std::vector<Vector3> vout(INPUT_COUNT);
+  if (qscaled.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      qscaled.push_back(in.qa[i] * 2.0f);
+    }
+  }
+  s.runBatchVs("Quaternion", "rotateBatch", INPUT_COUNT,
+               [&](size_t) { Rotations::rotateBatch(in.qa.data(), in.v3a.data(), vout.data(), INPUT_COUNT); return vout[0]; },
+               "operator*(Vector3) loop", [&](size_t) {
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) vout[k] = in.qa[k] * in.v3a[k];
+                 return vout[0];
+               });
+  s.runBatchVs("Quaternion", "multiplyBatch", INPUT_COUNT,
+               [&](size_t) { Rotations::multiplyBatch(in.qa.data(), in.qb.data(), qout.data(), INPUT_COUNT); return qout[0]; },
+               "operator*(Quaternion) loop", [&](size_t) {
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) qout[k] = in.qa[k] * in.qb[k];
+                 return qout[0];
+               });
+  s.runBatchVs("Quaternion", "normalizeBatch", INPUT_COUNT,
+               [&](size_t) { Rotations::normalizeBatch(qscaled.data(), qout.data(), INPUT_COUNT); return qout[0]; },
+               "normalized loop", [&](size_t) {
+                 for (size_t k = 0; k < INPUT_COUNT; ++k) qout[k] = qscaled[k].normalized();
+                 return qout[0];
+               });
+}
+
+void benchTransform(Suite& s, const Inputs& in) {
+  static std::vector<Transform> ta, tb;
+  if (ta.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      ta.push_back(Transform(in.v3a[i], in.qa[i], Vector3(1.5f, 1.5f, 1.5f)));
+      tb.push_back(Transform(in.v3b[i], in.qb[i], Vector3(0.5f, 2.0f, 1.0f)));
+    }
+  }
+  s.runVs("Transform", "operator*(Transform)", [&](size_t i) { return ta[i] * tb[i]; },
+          "TRS Matriz4x4 product", [&](size_t i) {
+            Matriz4x4 a = Matriz4x4::createTranslation(ta[i].translation()) * ta[i].rotation().toMatrix4x4() *
+                          Matriz4x4::createScale(ta[i].scale());
+            Matriz4x4 b = Matriz4x4::createTranslation(tb[i].translation()) * tb[i].rotation().toMatrix4x4() *
+                          Matriz4x4::createScale(tb[i].scale());
+            return a * b;
+          });
+  s.run("Transform", "inverse", [&](size_t i) { return ta[i].inverse(); });
+  s.run("Transform", "transformPoint", [&](size_t i) { return ta[i].transformPoint(in.v3b[i]); });
+  s.run("Transform", "toMatrix4x4 (rebuild)", [&](size_t i) {
+    Transform t(in.v3a[i], in.qa[i]);
+    return t.toMatrix4x4();
+  });
+  s.run("Transform", "toMatrix4x4 (cached)", [&](size_t i) { return ta[i].toMatrix4x4(); });
+
+  static Transforms::TransformHierarchy tree;
+  if (tree.size() == 0) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      tree.addNode(ta[i], i == 0 ? Transforms::TransformHierarchy::NO_PARENT : static_cast<int32_t>((i - 1) / 2));
+    }
+  }
+  s.runBatch("TransformHierarchy", "updateWorld (root dirty)", INPUT_COUNT, [&](size_t i) {
+    tree.setLocal(0, ta[i]);
+    tree.updateWorld();
+    return tree.world(static_cast<int32_t>(INPUT_COUNT - 1));
+  });
+}
+
+void benchAABB(Suite& s, const Inputs& in) {
+  static std::vector<AABB> boxes, out(INPUT_COUNT);
+  if (boxes.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      boxes.push_back(AABB().merge(in.v3a[i]).merge(in.v3b[i]));
+    }
+  }
+  s.runVs("AABB", "transform (Arvo)", [&](size_t i) { return boxes[i].transform(in.m4affine[i]); },
+          "8 transformed corners", [&](size_t i) {
+            AABB result;
+            for (int c = 0; c < 8; ++c) {
+              Vector3 corner(c & 1 ? boxes[i].max.x : boxes[i].min.x, c & 2 ? boxes[i].max.y : boxes[i].min.y,
+                             c & 4 ? boxes[i].max.z : boxes[i].min.z);
+              result.expand(in.m4affine[i] * corner);
+            }
+            return result;
+          });
+  s.run("AABB", "intersects", [&](size_t i) { return boxes[i].intersects(boxes[(i + 1) & INPUT_MASK]); });
+  s.run("AABB", "surfaceArea", [&](size_t i) { return boxes[i].surfaceArea(); });
+  s.runBatch("AABB", "transformBatch", INPUT_COUNT, [&](size_t i) {
+    Geometry::transformBatch(boxes.data(), in.m4affine[i], out.data(), INPUT_COUNT);
+    return out[0].min.x;
+  });
+  s.runBatch("AABB", "mergeBatch", INPUT_COUNT, [&](size_t) { return Geometry::mergeBatch(boxes.data(), INPUT_COUNT); });
+}
+
+void benchFrustum(Suite& s, const Inputs& in) {
+  static std::vector<Vector4> spheres;
+  static std::vector<AABB> boxes;
+  static std::vector<uint32_t> mask(Geometry::Frustum::maskWordCount(INPUT_COUNT));
+  if (spheres.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      spheres.push_back(Vector4(in.v3a[i].x, in.v3a[i].y, in.v3a[i].z, 0.25f));
+      boxes.push_back(AABB::fromCenterExtents(in.v3b[i], Vector3(0.25f, 0.25f, 0.25f)));
+    }
+  }
+  Matriz4x4 proj = Matriz4x4::createPerspective(1.5f, 1.0f, 0.1f, 10.0f);
+  Matriz4x4 view = Matriz4x4::createLookAt(Vector3(0.0f, 0.0f, 5.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+  const Geometry::Frustum frustum = Geometry::Frustum::fromMatrix(proj * view);
+
+  s.runBatchVs("Frustum", "cullSpheres", INPUT_COUNT,
+               [&](size_t) { return frustum.cullSpheres(spheres.data(), INPUT_COUNT, mask.data()); },
+               "intersectsSphere loop", [&](size_t) {
+                 size_t count = 0;
+                 for (size_t i = 0; i < INPUT_COUNT; ++i) {
+                   count += frustum.intersectsSphere(Vector3(spheres[i].x, spheres[i].y, spheres[i].z), spheres[i].w);
+                 }
+                 return count;
+               });
+  s.runBatchVs("Frustum", "cullAABBs", INPUT_COUNT,
+               [&](size_t) { return frustum.cullAABBs(boxes.data(), INPUT_COUNT, mask.data()); },
+               "intersectsAABB loop", [&](size_t) {
+                 size_t count = 0;
+                 for (size_t i = 0; i < INPUT_COUNT; ++i) {
+                   count += frustum.intersectsAABB(boxes[i]);
+                 }
+                 return count;
+               });
+}
+
+void benchBVH(Suite& s, const Inputs& in) {
+  static std::vector<AABB> boxes;
+  static Geometry::BVH bvh;
+  if (boxes.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      boxes.push_back(AABB::fromCenterExtents(in.v3a[i] * 10.0f, Vector3(0.1f, 0.1f, 0.1f)));
+    }
+    bvh.build(boxes.data(), boxes.size());
+  }
+  s.runBatch("BVH", "build", INPUT_COUNT, [&](size_t) {
+    Geometry::BVH tree;
+    tree.build(boxes.data(), boxes.size());
+    return tree.nodeCount();
+  });
+  s.runVs("BVH", "raycast", [&](size_t i) { return bvh.raycast(Ray(in.v3a[i] * 10.0f, in.v3b[i]), 1e30f).t; },
+          "slab test against every box", [&](size_t i) {
+            Ray ray(in.v3a[i] * 10.0f, in.v3b[i]);
+            Vector3 inv = ray.inverseDirection();
+            float best = 1e30f;
+            for (size_t b = 0; b < INPUT_COUNT; ++b) {
+              best = Math::EMin(best, Geometry::intersectAABB(ray, inv, boxes[b], best));
+            }
+            return best;
+          });
+  s.runVs("BVH", "queryAABB", [&](size_t i) {
+            return bvh.queryAABB(AABB::fromCenterExtents(in.v3b[i] * 10.0f, Vector3(1.0f, 1.0f, 1.0f)),
+                                 [](uint32_t) {});
+          },
+          "intersects against every box", [&](size_t i) {
+            AABB query = AABB::fromCenterExtents(in.v3b[i] * 10.0f, Vector3(1.0f, 1.0f, 1.0f));
+            size_t hits = 0;
+            for (size_t b = 0; b < INPUT_COUNT; ++b) {
+              hits += query.intersects(boxes[b]);
+            }
+            return hits;
+          });
+}
+
+void benchRay(Suite& s, const Inputs& in) {
+  static std::vector<Vector3> vertices;
+  static std::vector<Geometry::TrianglePacket8> triangles;
+  static std::vector<Geometry::RayPacket8> rays;
+  if (vertices.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      vertices.push_back(in.v3a[i] * 4.0f + in.v3b[(i + 1) & INPUT_MASK]);
+    }
+    for (size_t i = 0; i < INPUT_COUNT; i += 8) {
+      Geometry::TrianglePacket8 tris;
+      Geometry::RayPacket8 packet;
+      for (int lane = 0; lane < 8; ++lane) {
+        tris.set(lane, vertices[(i + lane) & INPUT_MASK], vertices[(i + lane + 1) & INPUT_MASK],
+                 vertices[(i + lane + 2) & INPUT_MASK]);
+        packet.set(lane, Ray(in.v3a[i + lane] * -4.0f, in.v3b[i + lane]));
+      }
+      triangles.push_back(tris);
+      rays.push_back(packet);
+    }
+  }
+  const size_t packetMask = INPUT_COUNT / 8 - 1;
+  s.run("Ray", "intersectTriangle", [&](size_t i) {
+    return Geometry::intersectTriangle(Ray(in.v3a[i] * -4.0f, in.v3b[i]), vertices[i], vertices[(i + 1) & INPUT_MASK],
+                                       vertices[(i + 2) & INPUT_MASK]);
+  });
+  s.runVs("Ray", "intersectTriangles 1 ray x 8", [&](size_t i) {
+            float t[8];
+            return Geometry::intersectTriangles(Ray(in.v3a[i] * -4.0f, in.v3b[i]), triangles[i & packetMask], 1e30f, t);
+          },
+          "intersectTriangle x 8", [&](size_t i) {
+            Ray ray(in.v3a[i] * -4.0f, in.v3b[i]);
+            size_t base = (i & packetMask) * 8;
+            int mask = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+              size_t k = base + lane;
+              mask |= (Geometry::intersectTriangle(ray, vertices[k], vertices[(k + 1) & INPUT_MASK],
+                                                   vertices[(k + 2) & INPUT_MASK], 1e30f) != Geometry::RAY_MISS) << lane;
+            }
+            return mask;
+          });
+  s.runVs("Ray", "intersectTriangle 8 rays x 1", [&](size_t i) {
+            float t[8];
+            return Geometry::intersectTriangle(rays[i & packetMask], vertices[i], vertices[(i + 1) & INPUT_MASK],
+                                               vertices[(i + 2) & INPUT_MASK], 1e30f, t);
+          },
+          "intersectTriangle x 8", [&](size_t i) {
+            const Geometry::RayPacket8& packet = rays[i & packetMask];
+            int mask = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+              mask |= (Geometry::intersectTriangle(packet.get(lane), vertices[i], vertices[(i + 1) & INPUT_MASK],
+                                                   vertices[(i + 2) & INPUT_MASK], 1e30f) != Geometry::RAY_MISS) << lane;
+            }
+            return mask;
+          });
+  s.runVs("Ray", "intersectAABB 8 rays x 1", [&](size_t i) {
+            float t[8];
+            return Geometry::intersectAABB(rays[i & packetMask], AABB::fromCenterExtents(in.v3a[i], Vector3(0.5f, 0.5f, 0.5f)), 1e30f, t);
+          },
+          "intersectAABB x 8", [&](size_t i) {
+            const Geometry::RayPacket8& packet = rays[i & packetMask];
+            AABB box = AABB::fromCenterExtents(in.v3a[i], Vector3(0.5f, 0.5f, 0.5f));
+            int mask = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+              mask |= (Geometry::intersectAABB(packet.get(lane), box, 1e30f) != Geometry::RAY_MISS) << lane;
+            }
+            return mask;
+          });
+}
+
+void benchSpatialHashGrid(Suite& s, const Inputs& in) {
+  static std::vector<Vector3> points;
+  static Geometry::SpatialHashGrid grid(1.0f);
+  if (points.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      points.push_back(in.v3a[i]);
+    }
+    grid.build(points.data(), points.size());
+  }
+  s.runBatch("SpatialHashGrid", "build", INPUT_COUNT, [&](size_t) {
+    Geometry::SpatialHashGrid rebuilt(1.0f);
+    rebuilt.build(points.data(), points.size());
+    return rebuilt.size();
+  });
+  s.runVs("SpatialHashGrid", "queryRadius", [&](size_t i) {
+            size_t hits = 0;
+            grid.queryRadius(in.v3b[i], 1.0f, [&hits](uint32_t, float) { ++hits; });
+            return hits;
+          },
+          "distance against every point", [&](size_t i) {
+            Vector3 center = in.v3b[i];
+            size_t hits = 0;
+            for (size_t p = 0; p < INPUT_COUNT; ++p) {
+              hits += center.distance(points[p]) <= 1.0f;
+            }
+            return hits;
+          });
+  s.runVs("SpatialHashGrid", "queryNearest", [&](size_t i) { return grid.queryNearest(in.v3b[i]).index; },
+          "squared distance against every point", [&](size_t i) {
+            Vector3 center = in.v3b[i];
+            float best = 1e30f;
+            uint32_t index = 0;
+            for (size_t p = 0; p < INPUT_COUNT; ++p) {
+              float d = (points[p] - center).squareMagnitude();
+              if (d < best) {
+                best = d;
+                index = static_cast<uint32_t>(p);
+              }
+            }
+            return index;
+          });
+}
+
+void benchKDTree(Suite& s, const Inputs& in) {
+  static std::vector<Vector3> points;
+  static Geometry::KDTree tree;
+  if (points.empty()) {
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+      points.push_back(in.v3a[i]);
+    }
+    tree.build(points.data(), points.size());
+  }
+  s.runBatch("KDTree", "build", INPUT_COUNT, [&](size_t) {
+    Geometry::KDTree rebuilt;
+    rebuilt.build(points.data(), points.size());
+    return rebuilt.size();
+  });
+  s.runVs("KDTree", "queryNearest", [&](size_t i) { return tree.queryNearest(in.v3b[i]).index; },
+          "squared distance against every point", [&](size_t i) {
+            float best = 1e30f;
+            uint32_t index = 0;
+            for (size_t p = 0; p < INPUT_COUNT; ++p) {
+              float d = (points[p] - in.v3b[i]).squareMagnitude();
+              if (d < best) {
+                best = d;
+                index = static_cast<uint32_t>(p);
+              }
+            }
+            return index;
+          });
+  std::vector<Geometry::KDTree::Neighbor> neighbors;
+  s.run("KDTree", "queryKNearest 8", [&](size_t i) { return tree.queryKNearest(in.v3b[i], 8, neighbors); });
+  s.run("KDTree", "queryRadius", [&](size_t i) {
+    size_t hits = 0;
+    tree.queryRadius(in.v3b[i], 1.0f, [&hits](uint32_t, float) { ++hits; });
+    return hits;
+  });
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    if (std::strcmp(arg, "--baseline") == 0) {
+      options.baseline = true;
+    }
+    else if (std::strncmp(arg, "--filter=", 9) == 0) {
+      options.filter = arg + 9;
+    }
+    else if (std::strncmp(arg, "--min-time=", 11) == 0) {
+      options.minTimeMs = std::atof(arg + 11);
+    }
+    else if (std::strncmp(arg, "--out=", 6) == 0) {
+      options.outPath = arg + 6;
+    }
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--baseline] [--filter=<substring>] [--min-time=<ms>] [--out=<file.json>]\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    return 1;
+  }
+
+  Inputs inputs;
+  Suite suite(options);
+  benchMath(suite, inputs);
+  benchVector2(suite, inputs);
+  benchVector3(suite, inputs);
+  benchVector4(suite, inputs);
+  benchMatriz2x2(suite, inputs);
+  benchMatriz3x3(suite, inputs);
+  benchMatriz4x4(suite, inputs);
+  benchQuaternion(suite, inputs);
+  benchTransform(suite, inputs);
+  benchAABB(suite, inputs);
+  benchFrustum(suite, inputs);
+  benchBVH(suite, inputs);
+  benchRay(suite, inputs);
+  benchSpatialHashGrid(suite, inputs);
+  benchKDTree(suite, inputs);
+
+  if (options.outPath.empty()) {
+    suite.writeJson(std::cout);
+  }
+  else {
+    std::ofstream file(options.outPath);
+    if (!file) {
+      std::cerr << "cannot open " << options.outPath << "\n";
+      return 1;
+    }
+    suite.writeJson(file);
+  }
+  return 0;
+}
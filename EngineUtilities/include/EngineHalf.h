@@ -0,0 +1,217 @@
+#pragma once
+/*
+ *  @brief IEEE 754 binary16 storage type for bandwidth-bound buffers (vertex streams, GPU uploads).
+ *  Arithmetic is done in float: a half converts implicitly to float and back, so the templated
+ *  vector and quaternion types work with it unchanged. Uses F16C when the compiler targets it.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "EngineMath.h"
+#include "EngineSIMD.h"
+
+#if defined(__F16C__) && defined(ENGINEUTILITIES_SIMD_SSE2)
+  #include <immintrin.h>
+  #define ENGINEUTILITIES_F16C 1
+#endif
+
+namespace EngineUtilities {
+namespace Math {
+
+namespace detail {
+
+/*
+* @brief Converts a float to binary16 bits, rounding to nearest even.
+*  Values beyond the half range become infinity; NaN stays NaN.
+*/
+inline
+  unsigned short floatToHalfBits(float value) {
+#if defined(ENGINEUTILITIES_F16C)
+    return (unsigned short)_cvtss_sh(value, 0);
+#else
+    unsigned int bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    unsigned int sign = (bits >> 16) & 0x8000u;
+    unsigned int absBits = bits & 0x7fffffffu;
+
+    if (absBits >= 0x7f800000u) {
+      unsigned int nan = (absBits > 0x7f800000u) ? (0x200u | ((absBits >> 13) & 0x3ffu)) : 0u;
+      return (unsigned short)(sign | 0x7c00u | nan);
+    }
+    if (absBits >= 0x477ff000u) {
+      return (unsigned short)(sign | 0x7c00u);
+    }
+    if (absBits < 0x38800000u) {
+      if (absBits < 0x33000000u) return (unsigned short)sign;
+      unsigned int exponent = absBits >> 23;
+      unsigned int mantissa = (absBits & 0x7fffffu) | 0x800000u;
+      unsigned int shift = 126u - exponent;
+      unsigned int result = mantissa >> shift;
+      unsigned int remainder = mantissa & ((1u << shift) - 1u);
+      unsigned int halfway = 1u << (shift - 1u);
+      if (remainder > halfway || (remainder == halfway && (result & 1u))) ++result;
+      return (unsigned short)(sign | result);
+    }
+
+    unsigned int result = (absBits - 0x38000000u) >> 13;
+    unsigned int remainder = absBits & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u))) ++result;
+    return (unsigned short)(sign | result);
+#endif
+  }
+
+/*
+* @brief Converts binary16 bits to a float (exact).
+*/
+inline
+  float halfBitsToFloat(unsigned short h) {
+#if defined(ENGINEUTILITIES_F16C)
+    return _cvtsh_ss(h);
+#else
+    unsigned int sign = ((unsigned int)h & 0x8000u) << 16;
+    unsigned int exponent = ((unsigned int)h >> 10) & 0x1fu;
+    unsigned int mantissa = (unsigned int)h & 0x3ffu;
+    unsigned int bits = 0;
+
+    if (exponent == 0) {
+      if (mantissa == 0) {
+        bits = sign;
+      }
+      else {
+        unsigned int e = 113;
+        while (!(mantissa & 0x400u)) {
+          mantissa <<= 1;
+          --e;
+        }
+        bits = sign | (e << 23) | ((mantissa & 0x3ffu) << 13);
+      }
+    }
+    else if (exponent == 31) {
+      bits = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else {
+      bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float result = 0.0f;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+#endif
+  }
+}
+
+/*
+*  @brief 16-bit floating point value (1 sign, 5 exponent, 10 mantissa bits).
+*  Range +-65504, ~3 decimal digits. Converts implicitly to and from float.
+*/
+struct half {
+  /*
+  *  @brief Raw binary16 bits.
+  */
+  unsigned short bits;
+
+  constexpr half() : bits(0) {}
+
+  /*
+  *  @brief Converts from float, rounding to nearest even.
+  */
+  inline half(float value) : bits(detail::floatToHalfBits(value)) {}
+
+  /*
+  *  @brief Converts to float (exact).
+  */
+  inline operator float() const {
+    return detail::halfBitsToFloat(bits);
+  }
+
+  /*
+  *  @brief Builds a half from its raw bit pattern.
+  */
+  static constexpr half fromBits(unsigned short rawBits) {
+    half h;
+    h.bits = rawBits;
+    return h;
+  }
+
+  inline half& operator+=(float value) { return *this = half(float(*this) + value); }
+  inline half& operator-=(float value) { return *this = half(float(*this) - value); }
+  inline half& operator*=(float value) { return *this = half(float(*this) * value); }
+  inline half& operator/=(float value) { return *this = half(float(*this) / value); }
+};
+
+static_assert(sizeof(half) == 2, "half must stay 16 bits");
+static_assert(std::is_trivially_copyable<half>::value, "half must be trivially copyable");
+
+/*
+* @brief Constants for half instantiations. Stored as float since half has no constexpr conversion.
+*/
+template <>
+struct Constants<half> {
+  static constexpr float PI = 3.14159265358979323846f;
+  static constexpr float HALF_PI = 1.57079632679489661923f;
+  static constexpr float TWO_PI = 6.28318530717958647692f;
+  static constexpr float EPSILON = 0.001f;
+};
+
+/*
+* @brief Checks if two halves are approximately equal using Constants<half>::EPSILON.
+*/
+inline
+  bool approxEqual(half a, half b) {
+    return abs(float(a) - float(b)) < Constants<half>::EPSILON;
+  }
+
+/*
+* @brief Sine and cosine for half outputs (computed in float).
+*/
+inline
+  void sincos(half angle_rad, half* s, half* c) {
+    float sf = 0.0f, cf = 0.0f;
+    sincos(float(angle_rad), &sf, &cf);
+    *s = sf;
+    *c = cf;
+  }
+
+/*
+* @brief Converts n floats to half (8 lanes at a time with F16C).
+*  @param in Input floats.
+*  @param out Output halves.
+*  @param n Number of elements.
+*/
+inline
+  void toHalf_n(const float* in, half* out, size_t n) {
+    size_t i = 0;
+#if defined(ENGINEUTILITIES_F16C)
+    for (; i + 8 <= n; i += 8) {
+      __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), 0);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+    }
+#endif
+    for (; i < n; ++i) {
+      out[i] = half(in[i]);
+    }
+  }
+
+/*
+* @brief Converts n halves to float (8 lanes at a time with F16C).
+*  @param in Input halves.
+*  @param out Output floats.
+*  @param n Number of elements.
+*/
+inline
+  void toFloat_n(const half* in, float* out, size_t n) {
+    size_t i = 0;
+#if defined(ENGINEUTILITIES_F16C)
+    for (; i + 8 <= n; i += 8) {
+      __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+      _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    for (; i < n; ++i) {
+      out[i] = float(in[i]);
+    }
+  }
+
+ }
+}
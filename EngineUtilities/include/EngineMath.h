@@ -1,38 +1,63 @@
 #pragma once
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include "EngineSIMD.h"
+
 namespace EngineUtilities {
 namespace Math {
 
 /*
 * @brief Mathematical constant PI (?), ratio of a circle's circumference to its diameter.
 */
-const 
+constexpr 
   float PI = 3.14159265358979323846f;
 /*
   * @brief Mathematical constant HALF_PI (?/2), half of PI.
 */
-const 
+constexpr 
   float HALF_PI = PI * 0.5f;
 /*
   * @brief Mathematical constant TWO_PI (2?), double of PI.
 */
-const 
+constexpr 
   float TWO_PI = PI * 2.0f;
 /*
   * @brief Mathematical constant E, base of the natural logarithm.
 */
-const 
+constexpr 
   float E = 2.71828182845904523536f;
 
 /*
 * @brief Small epsilon value for floating point comparisons.
 */
-const 
+constexpr 
   float EPSILON = 0.00001f; 
 
+/*
+* @brief Per-scalar constants used by the templated vector, matrix and quaternion types.
+*  float keeps the values above; double uses full-precision PI and a tighter EPSILON.
+*/
+template <typename T>
+struct Constants {
+  static constexpr T PI = T(3.14159265358979323846);
+  static constexpr T HALF_PI = T(1.57079632679489661923);
+  static constexpr T TWO_PI = T(6.28318530717958647692);
+  static constexpr T EPSILON = T(0.00001);
+};
+
+template <>
+struct Constants<double> {
+  static constexpr double PI = 3.14159265358979323846;
+  static constexpr double HALF_PI = 1.57079632679489661923;
+  static constexpr double TWO_PI = 6.28318530717958647692;
+  static constexpr double EPSILON = 1e-9;
+};
+
 /*
 * @brief Returns the absolute value of a float.
 */
-inline 
+constexpr 
   float abs(float val) {
     return (val < 0.0f) ? -val : val;
   }
@@ -40,7 +65,7 @@ inline
 /*
 * @brief Checks if two floats are approximately equal using EPSILON.
 */
-inline 
+constexpr 
   bool approxEqual(float a, float b) {
     return abs(a - b) < EPSILON;
   }
@@ -48,7 +73,7 @@ inline
 /*
 * @brief Returns the maximum of two float values.
 */
-inline 
+constexpr 
   float EMax(float a, float b) {
     return a > b ? a : b;
   }
@@ -56,7 +81,7 @@ inline
 /*
 * @brief Returns the minimum of two float values.
 */
-inline 
+constexpr 
   float EMin(float a, float b) {
     return a < b ? a : b;
   }
@@ -64,13 +89,13 @@ inline
 /*
 * @brief Calculates the power of a base raised to an integer exponent.
 */
-inline 
+constexpr 
   float power(float base, int exp) {
     if (exp == 0) return 1.0f;
      if (approxEqual(base, 0.0f)) return 0.0f;
 
   float result = 1.0f;
-    int abs_exp = abs(exp);
+    int abs_exp = exp < 0 ? -exp : exp;
       for (int i = 0; i < abs_exp; ++i) {
         result *= base;
       }
@@ -83,7 +108,7 @@ inline
 /*
 * @brief Calculates the factorial of an integer n.
 */
-inline 
+constexpr 
   long long factorial(int n) {
     long long res = 1;
       for (int i = 2; i <= n; ++i) {
@@ -92,10 +117,41 @@ inline
       return res;
     }
 
+/*
+* @brief Returns the largest integer less than or equal to val.
+*/
+constexpr 
+  float floor(float val) {
+    long long i = (long long)val;
+      if (val < 0 && val != i) {
+        return (float)(i - 1);
+      }
+        return (float)i;
+    }
+
+/*
+* @brief Returns the smallest integer greater than or equal to val.
+*/
+constexpr float ceil(float val) {
+  long long i = (long long)val;
+    if (val > 0 && val != i) {
+       return (float)(i + 1);
+    }
+      return (float)i;
+   }
+
+/*
+* @brief Rounds val to the nearest integer.
+*/
+constexpr 
+  float round(float val) {
+    return floor(val + 0.5f);
+  }
+
 /*
 * @brief Normalizes an angle in radians to the range [-PI, PI].
 */
-inline 
+constexpr 
   float normalizeAngle(float angle_rad) {
    angle_rad = angle_rad - TWO_PI * floor(angle_rad / TWO_PI);
     if (angle_rad > PI) {
@@ -108,62 +164,223 @@ inline
     }
 
 /*
-* @brief Calculates the sine of an angle in radians using Taylor series.
+* @brief Accuracy tiers of the polynomial trig engine.
+*  Fast uses degree 5/4 minimax polynomials (abs. error ~1.5e-6).
+*  Accurate uses degree 7/6 minimax polynomials (within ~1 ulp on the reduced range).
 */
-inline 
-  float sin(float angle_rad) {
-    angle_rad = normalizeAngle(angle_rad); 
-
-  float result = 0.0f;
-  float x_pow = angle_rad;
-  int sign = 1;
-   for (int n = 1; n <= 13; n += 2) { 
-    result += sign * x_pow / static_cast<float>(factorial(n));
-      x_pow *= (angle_rad * angle_rad); 
-        sign *= -1;
-   }
-    return result;
-    }
+enum class TrigAccuracy {
+  Fast,
+  Accurate
+};
 
 /*
-* @brief Calculates the cosine of an angle in radians using Taylor series.
+* @brief Default accuracy tier used by sin, cos and sincos.
+*  Define ENGINEUTILITIES_FAST_TRIG before including this header to default to the fast tier.
 */
-inline 
-  float cos(float angle_rad) {
-    angle_rad = normalizeAngle(angle_rad); 
-    float result = 0.0f;
-     float x_pow = 1.0f;
-      int sign = 1;
-
-      for (int n = 0; n <= 12; n += 2) { 
-       result += sign * x_pow / static_cast<float>(factorial(n));
-       x_pow *= (angle_rad * angle_rad);
-       sign *= -1;
-      }
-      return result;
+#ifdef ENGINEUTILITIES_FAST_TRIG
+constexpr 
+  TrigAccuracy DEFAULT_TRIG_ACCURACY = TrigAccuracy::Fast;
+#else
+constexpr 
+  TrigAccuracy DEFAULT_TRIG_ACCURACY = TrigAccuracy::Accurate;
+#endif
+
+namespace detail {
+
+/*
+* @brief 2/PI, used to find the quadrant of an angle.
+*/
+constexpr 
+  float TWO_OVER_PI = 0.636619772367581343076f;
+
+/*
+* @brief PI/2 split in three parts (Cody-Waite) so that k * PIO2_HI is exact.
+*/
+constexpr float PIO2_HI = 1.5703125f;
+constexpr float PIO2_MID = 4.837512969970703125e-4f;
+constexpr float PIO2_LO = 7.54978995489188216e-8f;
+
+/*
+* @brief Minimax coefficients of sin(r) = r + r^3 * P(r^2) on [-PI/4, PI/4].
+*/
+constexpr float SIN_FAST_C1 = -1.6663405846e-1f;
+constexpr float SIN_FAST_C2 = 8.1636278656e-3f;
+constexpr float SIN_C1 = -1.6666654611e-1f;
+constexpr float SIN_C2 = 8.3321608736e-3f;
+constexpr float SIN_C3 = -1.9515295891e-4f;
+
+/*
+* @brief Minimax coefficients of cos(r) = 1 - r^2/2 + r^4 * Q(r^2) on [-PI/4, PI/4].
+*/
+constexpr float COS_FAST_C1 = 4.1661167090e-2f;
+constexpr float COS_FAST_C2 = -1.3650475943e-3f;
+constexpr float COS_C1 = 4.166664568298827e-2f;
+constexpr float COS_C2 = -1.388731625493765e-3f;
+constexpr float COS_C3 = 2.443315711809948e-5f;
+
+/*
+* @brief Reduces an angle to r in [-PI/4, PI/4] such that angle = r + k * PI/2.
+*  @param angle_rad Angle in radians. Precision degrades for |angle_rad| > ~1e5.
+*  @param r Output reduced angle.
+*  @return Quadrant k modulo 4.
+*/
+constexpr 
+  int reduceQuadrant(float angle_rad, float& r) {
+    float fk = angle_rad * TWO_OVER_PI;
+    long long k = (long long)(fk + (fk >= 0.0f ? 0.5f : -0.5f));
+    float kf = (float)k;
+    r = ((angle_rad - kf * PIO2_HI) - kf * PIO2_MID) - kf * PIO2_LO;
+    return (int)(k & 3);
+  }
+
+/*
+* @brief Evaluates the sine polynomial on a reduced angle.
+*/
+constexpr 
+  float sinPoly(float r, TrigAccuracy accuracy) {
+    float z = r * r;
+    if (accuracy == TrigAccuracy::Fast) {
+      return r + r * z * (SIN_FAST_C1 + z * SIN_FAST_C2);
     }
+    return r + r * z * (SIN_C1 + z * (SIN_C2 + z * SIN_C3));
+  }
 
 /*
-* @brief Calculates the square root of a float using the Babylonian method.
+* @brief Evaluates the cosine polynomial on a reduced angle.
 */
-inline 
-  float sqrt(float val) {
-    if (val < 0.0f) return 0.0f;
-    if (approxEqual(val, 0.0f)) return 0.0f;
-
-  float x = val;
-  float y = 1.0f;
-    for (int i = 0; i < 15; ++i) { 
-      x = (x + y) / 2.0f;
-      y = val / x;
+constexpr 
+  float cosPoly(float r, TrigAccuracy accuracy) {
+    float z = r * r;
+    if (accuracy == TrigAccuracy::Fast) {
+      return 1.0f - 0.5f * z + z * z * (COS_FAST_C1 + z * COS_FAST_C2);
     }
-    return x;
+    return 1.0f - 0.5f * z + z * z * (COS_C1 + z * (COS_C2 + z * COS_C3));
+  }
+}
+
+/*
+* @brief Calculates sine and cosine of an angle in radians in a single pass.
+*  @param angle_rad Angle in radians.
+*  @param s Output sine.
+*  @param c Output cosine.
+*  @param accuracy Polynomial accuracy tier.
+*/
+constexpr 
+  void sincos(float angle_rad, float* s, float* c,
+              TrigAccuracy accuracy = DEFAULT_TRIG_ACCURACY) {
+    float r = 0.0f;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    float sr = detail::sinPoly(r, accuracy);
+    float cr = detail::cosPoly(r, accuracy);
+
+    float sv = (q & 1) ? cr : sr;
+    float cv = (q & 1) ? sr : cr;
+    *s = (q & 2) ? -sv : sv;
+    *c = ((q + 1) & 2) ? -cv : cv;
+  }
+
+/*
+* @brief Calculates the sine of an angle in radians (range reduction + minimax polynomial).
+*/
+constexpr 
+  float sin(float angle_rad, TrigAccuracy accuracy = DEFAULT_TRIG_ACCURACY) {
+    float r = 0.0f;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    float v = (q & 1) ? detail::cosPoly(r, accuracy) : detail::sinPoly(r, accuracy);
+    return (q & 2) ? -v : v;
+  }
+
+/*
+* @brief Calculates the cosine of an angle in radians (range reduction + minimax polynomial).
+*/
+constexpr 
+  float cos(float angle_rad, TrigAccuracy accuracy = DEFAULT_TRIG_ACCURACY) {
+    float r = 0.0f;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    float v = (q & 1) ? detail::sinPoly(r, accuracy) : detail::cosPoly(r, accuracy);
+    return ((q + 1) & 2) ? -v : v;
+  }
+
+namespace detail {
+
+/*
+* @brief Compile-time square root: scales val into [0.25, 4] by powers of 4,
+*  then runs Newton-Raphson in double precision. Used when sqrt/rsqrt are constant-evaluated.
+*/
+constexpr 
+  double sqrtConst(double val) {
+    double scale = 1.0;
+    while (val > 4.0) { val *= 0.25; scale *= 2.0; }
+    while (val < 0.25) { val *= 4.0; scale *= 0.5; }
+    double g = 0.5 * (val + 1.0);
+    for (int i = 0; i < 6; ++i) {
+      g = 0.5 * (g + val / g);
     }
+    return g * scale;
+  }
+}
+
+/*
+* @brief Calculates the reciprocal square root 1/sqrt(val).
+*  Uses the hardware estimate (rsqrtss / frsqrte) refined by one Newton-Raphson step
+*  (~23 bits), or a bit-level estimate with three Newton steps when no SIMD is available.
+*  The hardware estimates flush subnormals to zero, so those inputs are scaled by 2^64 first.
+*  Constant evaluation uses detail::sqrtConst instead.
+*  @return 1/sqrt(val), or 0 for val <= 0.
+*/
+constexpr 
+  float rsqrt(float val) {
+    if (val <= 0.0f) return 0.0f;
+    if (ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) return (float)(1.0 / detail::sqrtConst(val));
+#if defined(ENGINEUTILITIES_SIMD_SSE2) || defined(ENGINEUTILITIES_SIMD_NEON)
+    if (val < std::numeric_limits<float>::min()) return rsqrt(val * 18446744073709551616.0f) * 4294967296.0f;
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+    float e = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(val)));
+    return e * (1.5f - 0.5f * val * e * e);
+#elif defined(ENGINEUTILITIES_SIMD_NEON)
+    float32x2_t v = vdup_n_f32(val);
+    float32x2_t e = vrsqrte_f32(v);
+    e = vmul_f32(e, vrsqrts_f32(vmul_f32(v, e), e));
+    return vget_lane_f32(e, 0);
+#else
+    unsigned int bits = 0;
+    std::memcpy(&bits, &val, sizeof(bits));
+    bits = 0x5f375a86u - (bits >> 1);
+    float e = 0.0f;
+    std::memcpy(&e, &bits, sizeof(e));
+    float half = 0.5f * val;
+    e = e * (1.5f - half * e * e);
+    e = e * (1.5f - half * e * e);
+    e = e * (1.5f - half * e * e);
+    return e;
+#endif
+  }
+
+/*
+* @brief Calculates the square root of a float.
+*  Uses the hardware instruction (sqrtss / fsqrt) when available, otherwise val * rsqrt(val).
+*  Constant evaluation uses detail::sqrtConst instead.
+*  @return sqrt(val), or 0 for val <= 0.
+*/
+constexpr 
+  float sqrt(float val) {
+    if (val <= 0.0f) return 0.0f;
+    if (ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) return (float)detail::sqrtConst(val);
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+    return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(val)));
+#elif defined(ENGINEUTILITIES_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return vget_lane_f32(vsqrt_f32(vdup_n_f32(val)), 0);
+#else
+    float s = val * rsqrt(val);
+    return 0.5f * (s + val / s);
+#endif
+  }
 
 /*
 * @brief Calculates the arctangent of x using Taylor series.
 */
-inline 
+constexpr 
   float atan(float x) {
     if (x > 1.0f) return HALF_PI - atan(1.0f / x);
     if (x < -1.0f) return -HALF_PI - atan(1.0f / x);
@@ -183,7 +400,7 @@ inline
 /*
 * @brief Calculates the arctangent of y/x considering the quadrant.
 */
-inline 
+constexpr 
   float atan2(float y, float x) {
     if (approxEqual(x, 0.0f)) {
       if (approxEqual(y, 0.0f)) return 0.0f; 
@@ -202,7 +419,7 @@ inline
 /*
 * @brief Calculates the arcsine of x using arctangent and square root.
 */
-inline 
+constexpr 
   float asin(float x) {
     if (x > 1.0f - EPSILON) return HALF_PI;
     if (x < -1.0f + EPSILON) return -HALF_PI;
@@ -217,7 +434,7 @@ float denom_sq = 1.0f - x * x;
 /*
 *  @brief Calculates the arccosine of x using arcsine.
 */
-inline 
+constexpr 
   float acos(float x) {
     if (x > 1.0f - EPSILON) return 0.0f;
      if (x < -1.0f + EPSILON) return PI;
@@ -227,7 +444,7 @@ inline
 /*
 *  @brief Converts degrees to radians.
 */
-inline 
+constexpr 
   float radians(float degrees) {
     return degrees * (PI / 180.0f);
   }
@@ -235,40 +452,504 @@ inline
 /*
 * @brief Converts radians to degrees.
 */
-inline 
+constexpr 
   float degrees(float radians) {
     return radians * (180.0f / PI);
   }
 
 /*
-* @brief Returns the largest integer less than or equal to val.
+* @brief Double-precision overloads used by the double instantiations of the templated types.
+*  They follow the float versions but keep double accuracy (fdlibm kernels for sin/cos).
+*/
+constexpr 
+  double abs(double val) {
+    return (val < 0.0) ? -val : val;
+  }
+
+constexpr 
+  bool approxEqual(double a, double b) {
+    return abs(a - b) < Constants<double>::EPSILON;
+  }
+
+constexpr 
+  double EMax(double a, double b) {
+    return a > b ? a : b;
+  }
+
+constexpr 
+  double EMin(double a, double b) {
+    return a < b ? a : b;
+  }
+
+/*
+* @brief Square root of a double (sqrtsd / fsqrt when available).
+*  @return sqrt(val), or 0 for val <= 0.
+*/
+constexpr 
+  double sqrt(double val) {
+    if (val <= 0.0) return 0.0;
+    if (ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) return detail::sqrtConst(val);
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+    return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(val)));
+#elif defined(ENGINEUTILITIES_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return vget_lane_f64(vsqrt_f64(vdup_n_f64(val)), 0);
+#else
+    return detail::sqrtConst(val);
+#endif
+  }
+
+/*
+* @brief Reciprocal square root of a double.
+*  @return 1/sqrt(val), or 0 for val <= 0.
+*/
+constexpr 
+  double rsqrt(double val) {
+    return (val <= 0.0) ? 0.0 : 1.0 / sqrt(val);
+  }
+
+namespace detail {
+
+/*
+* @brief PI/2 split in three 33-bit parts (fdlibm) for double range reduction.
+*/
+constexpr double PIO2_1_D = 1.57079632673412561417e+00;
+constexpr double PIO2_2_D = 6.07710050630396597660e-11;
+constexpr double PIO2_3_D = 2.02226624871116645580e-21;
+
+/*
+* @brief fdlibm __kernel_sin / __kernel_cos coefficients on [-PI/4, PI/4].
+*/
+constexpr double SIN_D1 = -1.66666666666666324348e-01;
+constexpr double SIN_D2 = 8.33333333332248946124e-03;
+constexpr double SIN_D3 = -1.98412698298579493134e-04;
+constexpr double SIN_D4 = 2.75573137070700676789e-06;
+constexpr double SIN_D5 = -2.50507602534068634195e-08;
+constexpr double SIN_D6 = 1.58969099521155010221e-10;
+constexpr double COS_D1 = 4.16666666666666019037e-02;
+constexpr double COS_D2 = -1.38888888888741095749e-03;
+constexpr double COS_D3 = 2.48015872894767294178e-05;
+constexpr double COS_D4 = -2.75573143513906633035e-07;
+constexpr double COS_D5 = 2.08757232129817482790e-09;
+constexpr double COS_D6 = -1.13596475577881948265e-11;
+
+/*
+* @brief Double version of reduceQuadrant. Precision degrades for |angle_rad| > ~1e9.
+*/
+constexpr 
+  int reduceQuadrant(double angle_rad, double& r) {
+    double fk = angle_rad * (2.0 / Constants<double>::PI);
+    long long k = (long long)(fk + (fk >= 0.0 ? 0.5 : -0.5));
+    double kf = (double)k;
+    r = ((angle_rad - kf * PIO2_1_D) - kf * PIO2_2_D) - kf * PIO2_3_D;
+    return (int)(k & 3);
+  }
+
+constexpr 
+  double sinPoly(double r) {
+    double z = r * r;
+    return r + r * z * (SIN_D1 + z * (SIN_D2 + z * (SIN_D3 + z * (SIN_D4 + z * (SIN_D5 + z * SIN_D6)))));
+  }
+
+constexpr 
+  double cosPoly(double r) {
+    double z = r * r;
+    return 1.0 - 0.5 * z + z * z * (COS_D1 + z * (COS_D2 + z * (COS_D3 + z * (COS_D4 + z * (COS_D5 + z * COS_D6)))));
+  }
+}
+
+/*
+* @brief Sine and cosine of a double angle in radians in a single pass.
+*/
+constexpr 
+  void sincos(double angle_rad, double* s, double* c) {
+    double r = 0.0;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    double sr = detail::sinPoly(r);
+    double cr = detail::cosPoly(r);
+
+    double sv = (q & 1) ? cr : sr;
+    double cv = (q & 1) ? sr : cr;
+    *s = (q & 2) ? -sv : sv;
+    *c = ((q + 1) & 2) ? -cv : cv;
+  }
+
+constexpr 
+  double sin(double angle_rad) {
+    double r = 0.0;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    double v = (q & 1) ? detail::cosPoly(r) : detail::sinPoly(r);
+    return (q & 2) ? -v : v;
+  }
+
+constexpr 
+  double cos(double angle_rad) {
+    double r = 0.0;
+    int q = detail::reduceQuadrant(angle_rad, r);
+    double v = (q & 1) ? detail::sinPoly(r) : detail::cosPoly(r);
+    return ((q + 1) & 2) ? -v : v;
+  }
+
+/*
+* @brief Arctangent of a double: two half-angle reductions to |x| <= tan(PI/16), then the series.
+*/
+constexpr 
+  double atan(double x) {
+    bool negative = x < 0.0;
+    if (negative) x = -x;
+    bool inverted = x > 1.0;
+    if (inverted) x = 1.0 / x;
+    x = x / (1.0 + sqrt(1.0 + x * x));
+    x = x / (1.0 + sqrt(1.0 + x * x));
+
+    double z = x * x;
+    double term = x;
+    double result = 0.0;
+    for (int n = 1; n <= 25; n += 2) {
+      result += term / n;
+      term *= -z;
+    }
+    result *= 4.0;
+    if (inverted) result = Constants<double>::HALF_PI - result;
+    return negative ? -result : result;
+  }
+
+/*
+* @brief Arctangent of y/x for doubles considering the quadrant.
+*/
+constexpr 
+  double atan2(double y, double x) {
+    if (x == 0.0) {
+      if (y == 0.0) return 0.0;
+      return (y > 0.0) ? Constants<double>::HALF_PI : -Constants<double>::HALF_PI;
+    }
+    double angle = atan(y / x);
+    if (x < 0.0) {
+      return (y >= 0.0) ? angle + Constants<double>::PI : angle - Constants<double>::PI;
+    }
+    return angle;
+  }
+
+/*
+* @brief Arcsine of a double, clamped to [-1, 1].
+*/
+constexpr 
+  double asin(double x) {
+    if (x >= 1.0) return Constants<double>::HALF_PI;
+    if (x <= -1.0) return -Constants<double>::HALF_PI;
+    return atan2(x, sqrt((1.0 - x) * (1.0 + x)));
+  }
+
+/*
+* @brief Arccosine of a double, clamped to [-1, 1].
+*/
+constexpr 
+  double acos(double x) {
+    if (x >= 1.0) return 0.0;
+    if (x <= -1.0) return Constants<double>::PI;
+    return atan2(sqrt((1.0 - x) * (1.0 + x)), x);
+  }
+
+
+namespace detail {
+
+/*
+* @brief Minimax coefficients of atan(a) = a * P(a^2) on [0, 1] (Abramowitz & Stegun 4.4.49).
+*/
+constexpr float ATAN_C0 = 0.9999993329f;
+constexpr float ATAN_C1 = -0.3332985605f;
+constexpr float ATAN_C2 = 0.1994653599f;
+constexpr float ATAN_C3 = -0.1390853351f;
+constexpr float ATAN_C4 = 0.0964200441f;
+constexpr float ATAN_C5 = -0.0559098861f;
+constexpr float ATAN_C6 = 0.0218612288f;
+constexpr float ATAN_C7 = -0.0040540580f;
+
+/*
+* @brief Evaluates the arctangent polynomial for a in [0, 1].
+*/
+constexpr 
+  float atanPoly(float a) {
+    float z = a * a;
+    return a * (ATAN_C0 + z * (ATAN_C1 + z * (ATAN_C2 + z * (ATAN_C3 +
+           z * (ATAN_C4 + z * (ATAN_C5 + z * (ATAN_C6 + z * ATAN_C7)))))));
+  }
+
+/*
+* @brief Scalar atan2 built on atanPoly, bit-compatible with the SIMD lanes.
+*/
+constexpr 
+  float atan2Poly(float y, float x) {
+    float ax = abs(x);
+    float ay = abs(y);
+    float mx = EMax(ax, ay);
+    float a = (mx > 0.0f) ? EMin(ax, ay) / mx : 0.0f;
+    float r = atanPoly(a);
+    if (ay > ax) r = HALF_PI - r;
+    if (x < 0.0f) r = PI - r;
+    return (y < 0.0f) ? -r : r;
+  }
+
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+/*
+* @brief 4-wide sine/cosine (accurate tier). Valid for |x| < 2^31 * PI/2.
 */
 inline 
-  float floor(float val) {
-    long long i = (long long)val;
-      if (val < 0 && val != i) {
-        return (float)(i - 1);
-      }
-        return (float)i;
+  void sincos4(__m128 x, __m128& s, __m128& c) {
+    __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(TWO_OVER_PI)));
+    __m128 kf = _mm_cvtepi32_ps(k);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(kf, _mm_set1_ps(PIO2_HI)));
+    r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(PIO2_MID)));
+    r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(PIO2_LO)));
+
+    __m128 z = _mm_mul_ps(r, r);
+    __m128 sp = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(SIN_C3)), _mm_set1_ps(SIN_C2));
+    sp = _mm_add_ps(_mm_mul_ps(z, sp), _mm_set1_ps(SIN_C1));
+    sp = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), sp));
+    __m128 cp = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(COS_C3)), _mm_set1_ps(COS_C2));
+    cp = _mm_add_ps(_mm_mul_ps(z, cp), _mm_set1_ps(COS_C1));
+    cp = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)),
+                    _mm_mul_ps(_mm_mul_ps(z, z), cp));
+
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    __m128 sv = _mm_or_ps(_mm_and_ps(swap, cp), _mm_andnot_ps(swap, sp));
+    __m128 cv = _mm_or_ps(_mm_and_ps(swap, sp), _mm_andnot_ps(swap, cp));
+    __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30));
+    __m128i k1 = _mm_add_epi32(k, _mm_set1_epi32(1));
+    __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k1, _mm_set1_epi32(2)), 30));
+    s = _mm_xor_ps(sv, sinSign);
+    c = _mm_xor_ps(cv, cosSign);
+  }
+
+/*
+* @brief 4-wide atan2 built on the same polynomial as atan2Poly.
+*/
+inline 
+  __m128 atan2_4(__m128 y, __m128 x) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 ay = _mm_andnot_ps(signMask, y);
+    __m128 mx = _mm_max_ps(ax, ay);
+    __m128 mn = _mm_min_ps(ax, ay);
+    __m128 zero = _mm_cmpeq_ps(mx, _mm_setzero_ps());
+    __m128 a = _mm_div_ps(mn, _mm_or_ps(_mm_and_ps(zero, _mm_set1_ps(1.0f)), _mm_andnot_ps(zero, mx)));
+
+    __m128 z = _mm_mul_ps(a, a);
+    __m128 p = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(ATAN_C7)), _mm_set1_ps(ATAN_C6));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C5));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C4));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C3));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C2));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C1));
+    p = _mm_add_ps(_mm_mul_ps(z, p), _mm_set1_ps(ATAN_C0));
+    __m128 r = _mm_mul_ps(a, p);
+
+    __m128 steep = _mm_cmpgt_ps(ay, ax);
+    r = _mm_or_ps(_mm_and_ps(steep, _mm_sub_ps(_mm_set1_ps(HALF_PI), r)), _mm_andnot_ps(steep, r));
+    __m128 negX = _mm_cmplt_ps(x, _mm_setzero_ps());
+    r = _mm_or_ps(_mm_and_ps(negX, _mm_sub_ps(_mm_set1_ps(PI), r)), _mm_andnot_ps(negX, r));
+    __m128 negY = _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), signMask);
+    return _mm_xor_ps(r, negY);
+  }
+
+/*
+* @brief SSE2 sine/cosine over arrays. Either output may be null.
+*  @return Number of elements processed (a multiple of 4).
+*/
+inline 
+  size_t sincos_n_sse2(const float* in, float* s, float* c, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 sv, cv;
+      sincos4(_mm_loadu_ps(in + i), sv, cv);
+      if (s) _mm_storeu_ps(s + i, sv);
+      if (c) _mm_storeu_ps(c + i, cv);
     }
+    return i;
+  }
 
 /*
-* @brief Returns the smallest integer greater than or equal to val.
+* @brief SSE2 atan2 over arrays.
+*  @return Number of elements processed (a multiple of 4).
 */
-inline float ceil(float val) {
-  long long i = (long long)val;
-    if (val > 0 && val != i) {
-       return (float)(i + 1);
+inline 
+  size_t atan2_n_sse2(const float* y, const float* x, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      _mm_storeu_ps(out + i, atan2_4(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
     }
-      return (float)i;
-   }
+    return i;
+  }
+#endif
 
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
 /*
-* @brief Rounds val to the nearest integer.
+* @brief 8-wide sine/cosine (accurate tier), AVX2 + FMA.
+*/
+ENGINEUTILITIES_TARGET_AVX2 inline 
+  void sincos8(__m256 x, __m256& s, __m256& c) {
+    __m256i k = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(TWO_OVER_PI)));
+    __m256 kf = _mm256_cvtepi32_ps(k);
+    __m256 r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(PIO2_HI), x);
+    r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(PIO2_MID), r);
+    r = _mm256_fnmadd_ps(kf, _mm256_set1_ps(PIO2_LO), r);
+
+    __m256 z = _mm256_mul_ps(r, r);
+    __m256 sp = _mm256_fmadd_ps(z, _mm256_set1_ps(SIN_C3), _mm256_set1_ps(SIN_C2));
+    sp = _mm256_fmadd_ps(z, sp, _mm256_set1_ps(SIN_C1));
+    sp = _mm256_fmadd_ps(_mm256_mul_ps(r, z), sp, r);
+    __m256 cp = _mm256_fmadd_ps(z, _mm256_set1_ps(COS_C3), _mm256_set1_ps(COS_C2));
+    cp = _mm256_fmadd_ps(z, cp, _mm256_set1_ps(COS_C1));
+    cp = _mm256_fmadd_ps(_mm256_mul_ps(z, z), cp,
+                         _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(k, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+    __m256 sv = _mm256_blendv_ps(sp, cp, swap);
+    __m256 cv = _mm256_blendv_ps(cp, sp, swap);
+    __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(k, _mm256_set1_epi32(2)), 30));
+    __m256i k1 = _mm256_add_epi32(k, _mm256_set1_epi32(1));
+    __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(k1, _mm256_set1_epi32(2)), 30));
+    s = _mm256_xor_ps(sv, sinSign);
+    c = _mm256_xor_ps(cv, cosSign);
+  }
+
+/*
+* @brief 8-wide atan2, AVX2 + FMA.
+*/
+ENGINEUTILITIES_TARGET_AVX2 inline 
+  __m256 atan2_8(__m256 y, __m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 ax = _mm256_andnot_ps(signMask, x);
+    __m256 ay = _mm256_andnot_ps(signMask, y);
+    __m256 mx = _mm256_max_ps(ax, ay);
+    __m256 mn = _mm256_min_ps(ax, ay);
+    __m256 zero = _mm256_cmp_ps(mx, _mm256_setzero_ps(), _CMP_EQ_OQ);
+    __m256 a = _mm256_div_ps(mn, _mm256_blendv_ps(mx, _mm256_set1_ps(1.0f), zero));
+
+    __m256 z = _mm256_mul_ps(a, a);
+    __m256 p = _mm256_fmadd_ps(z, _mm256_set1_ps(ATAN_C7), _mm256_set1_ps(ATAN_C6));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C5));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C4));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C3));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C2));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C1));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(ATAN_C0));
+    __m256 r = _mm256_mul_ps(a, p);
+
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(HALF_PI), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI), r), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+    __m256 negY = _mm256_and_ps(_mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ), signMask);
+    return _mm256_xor_ps(r, negY);
+  }
+
+/*
+* @brief AVX2 sine/cosine over arrays. Either output may be null.
+*  @return Number of elements processed (a multiple of 8).
+*/
+ENGINEUTILITIES_TARGET_AVX2 inline 
+  size_t sincos_n_avx2(const float* in, float* s, float* c, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 sv, cv;
+      sincos8(_mm256_loadu_ps(in + i), sv, cv);
+      if (s) _mm256_storeu_ps(s + i, sv);
+      if (c) _mm256_storeu_ps(c + i, cv);
+    }
+    return i;
+  }
+
+/*
+* @brief AVX2 atan2 over arrays.
+*  @return Number of elements processed (a multiple of 8).
+*/
+ENGINEUTILITIES_TARGET_AVX2 inline 
+  size_t atan2_n_avx2(const float* y, const float* x, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      _mm256_storeu_ps(out + i, atan2_8(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+    }
+    return i;
+  }
+#endif
+
+/*
+* @brief Runs the widest available sine/cosine kernel, then finishes the tail in scalar.
 */
 inline 
-  float round(float val) {
-    return floor(val + 0.5f);
+  void sincos_n_dispatch(const float* in, float* s, float* c, size_t n) {
+    size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+    if (SIMD::hasAVX2()) {
+      i = sincos_n_avx2(in, s, c, n);
+    }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+    i += sincos_n_sse2(in + i, s ? s + i : nullptr, c ? c + i : nullptr, n - i);
+#endif
+    for (; i < n; ++i) {
+      float sv, cv;
+      sincos(in[i], &sv, &cv, TrigAccuracy::Accurate);
+      if (s) s[i] = sv;
+      if (c) c[i] = cv;
+    }
+  }
+}
+
+/*
+* @brief Computes out[i] = sin(in[i]) for n angles in radians (accurate tier, SIMD when available).
+*  @param in Input angles.
+*  @param out Output sines. May alias in.
+*  @param n Number of elements.
+*/
+inline 
+  void sin_n(const float* in, float* out, size_t n) {
+    detail::sincos_n_dispatch(in, out, nullptr, n);
+  }
+
+/*
+* @brief Computes out[i] = cos(in[i]) for n angles in radians (accurate tier, SIMD when available).
+*  @param in Input angles.
+*  @param out Output cosines. May alias in.
+*  @param n Number of elements.
+*/
+inline 
+  void cos_n(const float* in, float* out, size_t n) {
+    detail::sincos_n_dispatch(in, nullptr, out, n);
+  }
+
+/*
+* @brief Computes sine and cosine of n angles in radians in one pass.
+*  @param in Input angles.
+*  @param s Output sines.
+*  @param c Output cosines.
+*  @param n Number of elements.
+*/
+inline 
+  void sincos_n(const float* in, float* s, float* c, size_t n) {
+    detail::sincos_n_dispatch(in, s, c, n);
   }
+
+/*
+* @brief Computes out[i] = atan2(y[i], x[i]) for n pairs (minimax polynomial, abs. error < 4e-7 rad).
+*  @param y Input Y coordinates.
+*  @param x Input X coordinates.
+*  @param out Output angles in [-PI, PI].
+*  @param n Number of elements.
+*/
+inline 
+  void atan2_n(const float* y, const float* x, float* out, size_t n) {
+    size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+    if (SIMD::hasAVX2()) {
+      i = detail::atan2_n_avx2(y, x, out, n);
+    }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+    i += detail::atan2_n_sse2(y + i, x + i, out + i, n - i);
+#endif
+    for (; i < n; ++i) {
+      out[i] = detail::atan2Poly(y[i], x[i]);
+    }
+  }
+
  } 
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+/*
+ *  @brief Minimal fork-join helpers used by the batch kernels of EngineUtilities.
+ *  Define ENGINEUTILITIES_NO_THREADS before including any header to run everything on the calling thread.
+ */
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace EngineUtilities {
+namespace Parallel {
+
+/*
+*  @brief Number of hardware threads available to parallelFor (at least 1).
+*/
+inline
+  unsigned workerCount() {
+#if defined(ENGINEUTILITIES_NO_THREADS)
+    return 1;
+#else
+    static const unsigned count = std::thread::hardware_concurrency();
+    return count ? count : 1;
+#endif
+  }
+
+/*
+*  @brief Splits [begin, end) into contiguous chunks and runs fn(chunkBegin, chunkEnd) on each,
+*  one chunk per worker, using the calling thread for the first chunk. Ranges shorter than
+*  minChunk per worker use fewer workers; fn must not throw.
+*  @param begin First index.
+*  @param end One past the last index.
+*  @param minChunk Smallest range worth handing to a thread.
+*  @param fn Callable taking (size_t chunkBegin, size_t chunkEnd).
+*/
+template <typename Fn>
+inline
+  void parallelFor(size_t begin, size_t end, size_t minChunk, Fn&& fn) {
+    if (end <= begin) return;
+    size_t count = end - begin;
+    if (minChunk == 0) minChunk = 1;
+    size_t workers = (count + minChunk - 1) / minChunk;
+    if (workers > workerCount()) workers = workerCount();
+    if (workers <= 1) {
+      fn(begin, end);
+      return;
+    }
+
+    size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t t = 1; t < workers; ++t) {
+      size_t b = begin + t * chunk;
+      size_t e = (b + chunk < end) ? b + chunk : end;
+      if (b >= e) break;
+      threads.emplace_back([&fn, b, e]() { fn(b, e); });
+    }
+    fn(begin, begin + chunk);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+ }
+}
@@ -0,0 +1,324 @@
+#pragma once
+/*
+ *  @brief Platform detection for the SIMD code paths of EngineUtilities.
+ *  Define ENGINEUTILITIES_NO_SIMD before including any header to force the scalar fallbacks.
+ */
+
+#if !defined(ENGINEUTILITIES_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+  #define ENGINEUTILITIES_SIMD_SSE2 1
+  #include <emmintrin.h>
+#elif !defined(ENGINEUTILITIES_NO_SIMD) && (defined(__ARM_NEON) || defined(_M_ARM64))
+  #define ENGINEUTILITIES_SIMD_NEON 1
+  #include <arm_neon.h>
+#endif
+
+#if defined(ENGINEUTILITIES_SIMD_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+  #define ENGINEUTILITIES_SIMD_AVX2_DISPATCH 1
+  #include <immintrin.h>
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define ENGINEUTILITIES_TARGET_AVX2
+  #else
+    #define ENGINEUTILITIES_TARGET_AVX2 __attribute__((target("avx2,fma")))
+  #endif
+#endif
+
+/*
+ *  @brief Optional 16-byte storage mode for the four-float types (Vector4, Quaternion).
+ *  Define ENGINEUTILITIES_ALIGNED_VEC4 to give them alignas(16) so register loads are aligned.
+ *  Field names and sizeof stay the same either way; only alignof changes.
+ */
+#if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+  #define ENGINEUTILITIES_ALIGN16 alignas(16)
+#else
+  #define ENGINEUTILITIES_ALIGN16
+#endif
+
+/*
+ *  @brief Same storage mode for the templated four-component types: 16-byte alignment only when
+ *  four T fill a register (float). Smaller scalars like half keep their natural alignment.
+ */
+#if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+  #define ENGINEUTILITIES_ALIGN_VEC4(T) alignas(4 * sizeof(T) >= 16 ? 16 : alignof(T))
+#else
+  #define ENGINEUTILITIES_ALIGN_VEC4(T)
+#endif
+
+#if defined(ENGINEUTILITIES_SIMD_SSE2) || defined(ENGINEUTILITIES_SIMD_NEON)
+  #define ENGINEUTILITIES_SIMD_FLOAT4 1
+#endif
+
+/*
+ *  @brief True while a constexpr function is being evaluated at compile time.
+ *  constexpr functions use it to skip intrinsics and hardware estimates, which are not constant
+ *  expressions. Without compiler support it is always false and those functions only work at run time.
+ */
+#if defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+    #define ENGINEUTILITIES_HAS_CONSTANT_EVALUATED 1
+  #endif
+#endif
+#if !defined(ENGINEUTILITIES_HAS_CONSTANT_EVALUATED) && \
+    ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+  #define ENGINEUTILITIES_HAS_CONSTANT_EVALUATED 1
+#endif
+
+#if defined(ENGINEUTILITIES_HAS_CONSTANT_EVALUATED)
+  #define ENGINEUTILITIES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+  #define ENGINEUTILITIES_IS_CONSTANT_EVALUATED() false
+#endif
+
+#include <cstddef>
+#include <new>
+
+namespace EngineUtilities {
+namespace SIMD {
+
+/*
+*  @brief Byte alignment used for SIMD-friendly storage (one AVX register).
+*/
+const 
+  std::size_t SIMD_ALIGNMENT = 32;
+
+/*
+*  @brief Minimal std::allocator replacement that returns SIMD_ALIGNMENT-aligned blocks.
+*/
+template <typename T>
+struct AlignedAllocator {
+  using value_type = T;
+
+  AlignedAllocator() noexcept {}
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U>&) noexcept {}
+
+  inline T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(SIMD_ALIGNMENT)));
+  }
+
+  inline void deallocate(T* p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(SIMD_ALIGNMENT));
+  }
+
+  template <typename U>
+  inline bool operator==(const AlignedAllocator<U>&) const noexcept { return true; }
+  template <typename U>
+  inline bool operator!=(const AlignedAllocator<U>&) const noexcept { return false; }
+};
+
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+/*
+*  @brief Queries the CPU (and OS) for AVX2 + FMA support.
+*  @return True if 256-bit AVX2 kernels can run on this machine.
+*/
+inline
+  bool detectAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma) return false;
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+  }
+
+/*
+*  @brief Cached result of detectAVX2, evaluated once per process.
+*/
+inline
+  bool hasAVX2() {
+    static const bool supported = detectAVX2();
+    return supported;
+  }
+#endif
+
+
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+/*
+*  @brief One 128-bit register holding four floats (x, y, z, w in lanes 0..3).
+*/
+typedef __m128 float4;
+
+/*
+*  @brief Loads four consecutive floats (aligned load in ENGINEUTILITIES_ALIGNED_VEC4 mode).
+*/
+inline float4 load4(const float* p) {
+#if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+  return _mm_load_ps(p);
+#else
+  return _mm_loadu_ps(p);
+#endif
+}
+
+/*
+*  @brief Stores four consecutive floats (aligned store in ENGINEUTILITIES_ALIGNED_VEC4 mode).
+*/
+inline void store4(float* p, float4 v) {
+#if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+  _mm_store_ps(p, v);
+#else
+  _mm_storeu_ps(p, v);
+#endif
+}
+
+/*
+*  @brief Loads / stores four consecutive floats with no alignment requirement.
+*/
+inline float4 loadu4(const float* p) { return _mm_loadu_ps(p); }
+inline void storeu4(float* p, float4 v) { _mm_storeu_ps(p, v); }
+
+inline float4 set4(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+inline float4 splat4(float s) { return _mm_set1_ps(s); }
+inline float4 add4(float4 a, float4 b) { return _mm_add_ps(a, b); }
+inline float4 sub4(float4 a, float4 b) { return _mm_sub_ps(a, b); }
+inline float4 mul4(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+inline float4 div4(float4 a, float4 b) { return _mm_div_ps(a, b); }
+inline float4 min4(float4 a, float4 b) { return _mm_min_ps(a, b); }
+inline float4 max4(float4 a, float4 b) { return _mm_max_ps(a, b); }
+inline float4 abs4(float4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+
+/*
+*  @brief Per-lane 1 / sqrt(v): hardware estimate plus one Newton-Raphson step, as Math::rsqrt.
+*  Lanes <= 0 give inf / NaN; callers mask them.
+*/
+inline float4 rsqrt4(float4 v) {
+  float4 e = _mm_rsqrt_ps(v);
+  return _mm_mul_ps(e, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), v), e), e)));
+}
+
+/*
+*  @brief Lane compares (all-ones / all-zero lanes), mask AND and the lane sign bits as an int (bit i = lane i).
+*/
+inline float4 cmpge4(float4 a, float4 b) { return _mm_cmpge_ps(a, b); }
+inline float4 cmplt4(float4 a, float4 b) { return _mm_cmplt_ps(a, b); }
+inline float4 and4(float4 a, float4 b) { return _mm_and_ps(a, b); }
+inline float4 or4(float4 a, float4 b) { return _mm_or_ps(a, b); }
+inline int movemask4(float4 v) { return _mm_movemask_ps(v); }
+
+/*
+*  @brief Per lane: mask ? a : b (mask lanes all-ones or all-zero, as returned by the compares).
+*/
+inline float4 select4(float4 mask, float4 a, float4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+/*
+*  @brief Splits interleaved pairs: a = (x0 y0 x1 y1), b = (x2 y2 x3 y3) give even = x0..x3, odd = y0..y3.
+*/
+inline void deinterleave4(float4 a, float4 b, float4& even, float4& odd) {
+  even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+/*
+*  @brief In-place 4x4 transpose: rows a, b, c, d become columns (AoS <-> SoA).
+*/
+inline void transpose4(float4& a, float4& b, float4& c, float4& d) { _MM_TRANSPOSE4_PS(a, b, c, d); }
+
+/*
+*  @brief Lane permutes used by the quaternion product.
+*/
+inline float4 swizzleWZYX(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)); }
+inline float4 swizzleZWXY(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)); }
+inline float4 swizzleYXWZ(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+
+/*
+*  @brief Horizontal sum of the four lanes.
+*/
+inline float hsum4(float4 v) {
+  float4 s = _mm_add_ps(v, swizzleZWXY(v));
+  s = _mm_add_ss(s, swizzleYXWZ(s));
+  return _mm_cvtss_f32(s);
+}
+#elif defined(ENGINEUTILITIES_SIMD_NEON)
+typedef float32x4_t float4;
+
+inline float4 load4(const float* p) { return vld1q_f32(p); }
+inline void store4(float* p, float4 v) { vst1q_f32(p, v); }
+inline float4 loadu4(const float* p) { return vld1q_f32(p); }
+inline void storeu4(float* p, float4 v) { vst1q_f32(p, v); }
+inline float4 set4(float x, float y, float z, float w) {
+  float tmp[4] = { x, y, z, w };
+  return vld1q_f32(tmp);
+}
+inline float4 splat4(float s) { return vdupq_n_f32(s); }
+inline float4 add4(float4 a, float4 b) { return vaddq_f32(a, b); }
+inline float4 sub4(float4 a, float4 b) { return vsubq_f32(a, b); }
+inline float4 mul4(float4 a, float4 b) { return vmulq_f32(a, b); }
+inline float4 min4(float4 a, float4 b) { return vminq_f32(a, b); }
+inline float4 max4(float4 a, float4 b) { return vmaxq_f32(a, b); }
+inline float4 abs4(float4 v) { return vabsq_f32(v); }
+inline float4 cmpge4(float4 a, float4 b) { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+inline float4 cmplt4(float4 a, float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+inline float4 and4(float4 a, float4 b) {
+  return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+inline float4 or4(float4 a, float4 b) {
+  return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+inline float4 select4(float4 mask, float4 a, float4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+inline void deinterleave4(float4 a, float4 b, float4& even, float4& odd) {
+  float32x4x2_t split = vuzpq_f32(a, b);
+  even = split.val[0];
+  odd = split.val[1];
+}
+inline int movemask4(float4 v) {
+  uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(v), 31);
+  return static_cast<int>(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) |
+                          (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+}
+inline void transpose4(float4& a, float4& b, float4& c, float4& d) {
+  float32x4x2_t ab = vtrnq_f32(a, b);
+  float32x4x2_t cd = vtrnq_f32(c, d);
+  a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+  b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+  c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+  d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+#if defined(__aarch64__) || defined(_M_ARM64)
+inline float4 div4(float4 a, float4 b) { return vdivq_f32(a, b); }
+#else
+inline float4 div4(float4 a, float4 b) {
+  float4 r = vrecpeq_f32(b);
+  r = vmulq_f32(r, vrecpsq_f32(b, r));
+  r = vmulq_f32(r, vrecpsq_f32(b, r));
+  return vmulq_f32(a, r);
+}
+#endif
+
+inline float4 rsqrt4(float4 v) {
+  float4 e = vrsqrteq_f32(v);
+  return vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(v, e), e));
+}
+
+inline float4 swizzleYXWZ(float4 v) { return vrev64q_f32(v); }
+inline float4 swizzleZWXY(float4 v) { return vextq_f32(v, v, 2); }
+inline float4 swizzleWZYX(float4 v) { return vrev64q_f32(vextq_f32(v, v, 2)); }
+
+inline float hsum4(float4 v) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vaddvq_f32(v);
+#else
+  float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif
+}
+#endif
+
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+/*
+*  @brief Four-lane dot product.
+*/
+inline float dot4(float4 a, float4 b) {
+  return hsum4(mul4(a, b));
+}
+#endif
+
+ }
+}
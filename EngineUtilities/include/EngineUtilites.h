@@ -12,10 +12,22 @@
  *  @brief 3D vector type definition.
  */
 #include "Vector3.h"
+/*
+ *  @brief Structure-of-Arrays stream of 3D vectors.
+ */
+#include "Vector3SoA.h"
 /*
  *  @brief 4D vector type definition.
  */
 #include "Vector4.h"
+/*
+ *  @brief Lazy expression templates over Vector3 / Vector4 values and arrays.
+ */
+#include "VectorExpr.h"
+/*
+ *  @brief Batched squared-distance, range and nearest-point kernels over Vector2 / Vector3 / Vector4 arrays.
+ */
+#include "VectorBatch.h"
 /*
  *  @brief 2x2 matrix type definition.
  */
@@ -32,3 +44,39 @@
  *  @brief Quaternion type definition.
  */
 #include "Quaternion.h"
+/*
+ *  @brief Batched rotate / multiply / normalize kernels over Quaternion arrays.
+ */
+#include "QuaternionBatch.h"
+/*
+ *  @brief Translation / rotation / scale transform with a cached matrix.
+ */
+#include "Transform.h"
+/*
+ *  @brief Flat transform hierarchy with level-order world matrix propagation.
+ */
+#include "TransformHierarchy.h"
+/*
+ *  @brief Axis-aligned bounding box with batched transform / merge / overlap kernels.
+ */
+#include "AABB.h"
+/*
+ *  @brief View frustum planes and batched sphere / box culling.
+ */
+#include "Frustum.h"
+/*
+ *  @brief Ray type with triangle / box tests and 4- and 8-lane packet variants.
+ */
+#include "Ray.h"
+/*
+ *  @brief Bounding volume hierarchy (binned SAH) with ray and box queries.
+ */
+#include "BVH.h"
+/*
+ *  @brief Hashed uniform grid with radius and k-nearest queries over Vector3 positions.
+ */
+#include "SpatialHashGrid.h"
+/*
+ *  @brief Implicit k-d tree with nearest, k-nearest and radius queries over Vector3 points.
+ */
+#include "KDTree.h"
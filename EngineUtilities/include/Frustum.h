@@ -0,0 +1,300 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "EngineSIMD.h"
+#include "AABB.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matriz4x4.h"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief View frustum as six normalized planes (x, y, z = inward normal, w = distance term).
+      *  A point p is inside a plane when dot(n, p) + w >= 0. Planes are extracted from a
+      *  view-projection matrix (Gribb / Hartmann), so they are in whatever space the matrix maps
+      *  from: pass viewProj for world-space bounds, proj for view-space bounds.
+    */
+    class Frustum {
+    public:
+      enum Plane {
+        LEFT = 0,
+        RIGHT,
+        BOTTOM,
+        TOP,
+        NEAR_PLANE,
+        FAR_PLANE,
+        PLANE_COUNT
+      };
+
+      /*
+        *  @brief Object count below which the batch culls stay on the calling thread.
+      */
+      static constexpr size_t CULL_PARALLEL_THRESHOLD = 16384;
+
+      /*
+        *  @brief Default constructor. Every plane accepts everything.
+      */
+      inline Frustum() {
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+          m_planes[i] = Vectors::Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+      }
+
+      /*
+        *  @brief Extracts the six planes of a (view-)projection matrix.
+        *  Planes are normalized, so plane distances are true distances. A degenerate plane
+        *  (the far plane of an infinite projection) is replaced by one that accepts everything.
+        *  @param viewProj Column-major clip matrix (projection * view).
+        *  @param zeroToOneDepth True for clip depth in [0, w] (D3D / Vulkan, reversed Z),
+        *  false for [-w, w] (OpenGL). With reversed Z the NEAR_PLANE and FAR_PLANE slots swap.
+        *  @return Frustum of the matrix.
+      */
+      static inline Frustum fromMatrix(const Matrices::Matriz4x4& viewProj, bool zeroToOneDepth = false) {
+        const Matrices::Matriz4x4& m = viewProj;
+        // Row r of the matrix is (m[0][r], m[1][r], m[2][r], m[3][r]).
+        Vectors::Vector4 r0(m.m[0][0], m.m[1][0], m.m[2][0], m.m[3][0]);
+        Vectors::Vector4 r1(m.m[0][1], m.m[1][1], m.m[2][1], m.m[3][1]);
+        Vectors::Vector4 r2(m.m[0][2], m.m[1][2], m.m[2][2], m.m[3][2]);
+        Vectors::Vector4 r3(m.m[0][3], m.m[1][3], m.m[2][3], m.m[3][3]);
+
+        Frustum result;
+        result.m_planes[LEFT] = normalizePlane(r3 + r0);
+        result.m_planes[RIGHT] = normalizePlane(r3 - r0);
+        result.m_planes[BOTTOM] = normalizePlane(r3 + r1);
+        result.m_planes[TOP] = normalizePlane(r3 - r1);
+        result.m_planes[NEAR_PLANE] = normalizePlane(zeroToOneDepth ? r2 : r3 + r2);
+        result.m_planes[FAR_PLANE] = normalizePlane(r3 - r2);
+        return result;
+      }
+
+      inline const Vectors::Vector4& plane(int index) const { return m_planes[index]; }
+
+      /*
+        *  @brief Signed distance from a point to one plane (positive inside).
+      */
+      inline float distance(int index, const Vectors::Vector3& point) const {
+        const Vectors::Vector4& p = m_planes[index];
+        return p.x * point.x + p.y * point.y + p.z * point.z + p.w;
+      }
+
+      inline bool contains(const Vectors::Vector3& point) const {
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+          if (distance(i, point) < 0.0f) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /*
+        *  @brief True unless the sphere lies entirely outside one plane (conservative near corners).
+      */
+      inline bool intersectsSphere(const Vectors::Vector3& center, float radius) const {
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+          if (distance(i, center) < -radius) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /*
+        *  @brief True unless the box lies entirely outside one plane (tests the corner furthest
+        *  along each plane normal; conservative near frustum corners).
+      */
+      inline bool intersectsAABB(const AABB& box) const {
+        Vectors::Vector3 c = box.center();
+        Vectors::Vector3 e = box.extents();
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+          const Vectors::Vector4& p = m_planes[i];
+          float r = Math::abs(p.x) * e.x + Math::abs(p.y) * e.y + Math::abs(p.z) * e.z;
+          if (distance(i, c) < -r) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /*
+        *  @brief Number of uint32_t words a visibility mask for count objects needs.
+      */
+      static inline size_t maskWordCount(size_t count) {
+        return (count + 31) / 32;
+      }
+
+      /*
+        *  @brief Culls n bounding spheres, four per SIMD step, split across threads for large n.
+        *  @param spheres Spheres as (center.x, center.y, center.z, radius).
+        *  @param n Number of spheres.
+        *  @param visible Output mask of maskWordCount(n) words; bit (i % 32) of word (i / 32)
+        *  is set when sphere i is visible. Unused high bits of the last word are cleared.
+        *  @return Number of visible spheres.
+      */
+      inline size_t cullSpheres(const Vectors::Vector4* spheres, size_t n, uint32_t* visible) const {
+        Parallel::parallelFor(0, maskWordCount(n), CULL_PARALLEL_THRESHOLD / 32, [&](size_t first, size_t last) {
+          for (size_t word = first; word < last; ++word) {
+            size_t begin = word * 32;
+            size_t end = begin + 32 < n ? begin + 32 : n;
+            visible[word] = cullSpheresWord(spheres, begin, end);
+          }
+        });
+        return countBits(visible, maskWordCount(n));
+      }
+
+      /*
+        *  @brief Culls n boxes, four per SIMD step, split across threads for large n.
+        *  @param boxes Non-empty boxes.
+        *  @param n Number of boxes.
+        *  @param visible Output mask of maskWordCount(n) words, laid out like cullSpheres.
+        *  @return Number of visible boxes.
+      */
+      inline size_t cullAABBs(const AABB* boxes, size_t n, uint32_t* visible) const {
+        Parallel::parallelFor(0, maskWordCount(n), CULL_PARALLEL_THRESHOLD / 32, [&](size_t first, size_t last) {
+          for (size_t word = first; word < last; ++word) {
+            size_t begin = word * 32;
+            size_t end = begin + 32 < n ? begin + 32 : n;
+            visible[word] = cullAABBsWord(boxes, begin, end);
+          }
+        });
+        return countBits(visible, maskWordCount(n));
+      }
+
+    private:
+      static inline Vectors::Vector4 normalizePlane(const Vectors::Vector4& p) {
+        float lengthSq = p.x * p.x + p.y * p.y + p.z * p.z;
+        if (lengthSq < Math::EPSILON * Math::EPSILON) {
+          return Vectors::Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        float inv = 1.0f / Math::sqrt(lengthSq);
+        return Vectors::Vector4(p.x * inv, p.y * inv, p.z * inv, p.w * inv);
+      }
+
+      static inline size_t countBits(const uint32_t* words, size_t count) {
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+          uint32_t v = words[i];
+          v = v - ((v >> 1) & 0x55555555u);
+          v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+          total += (((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+        }
+        return total;
+      }
+
+      /*
+        *  @brief Visibility bits of spheres [begin, end), at most 32, bit 0 = sphere begin.
+      */
+      inline uint32_t cullSpheresWord(const Vectors::Vector4* spheres, size_t begin, size_t end) const {
+        uint32_t bits = 0;
+        size_t i = begin;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        SIMD::float4 px[PLANE_COUNT], py[PLANE_COUNT], pz[PLANE_COUNT], pw[PLANE_COUNT];
+        splatPlanes(px, py, pz, pw);
+        for (; i + 4 <= end; i += 4) {
+          SIMD::float4 cx = SIMD::loadu4(&spheres[i].x);
+          SIMD::float4 cy = SIMD::loadu4(&spheres[i + 1].x);
+          SIMD::float4 cz = SIMD::loadu4(&spheres[i + 2].x);
+          SIMD::float4 r = SIMD::loadu4(&spheres[i + 3].x);
+          SIMD::transpose4(cx, cy, cz, r);
+          SIMD::float4 zero = SIMD::splat4(0.0f);
+          SIMD::float4 inside = SIMD::cmpge4(zero, zero);
+          for (int p = 0; p < PLANE_COUNT; ++p) {
+            SIMD::float4 d = SIMD::add4(SIMD::add4(SIMD::mul4(px[p], cx), SIMD::mul4(py[p], cy)),
+                                        SIMD::add4(SIMD::mul4(pz[p], cz), pw[p]));
+            inside = SIMD::and4(inside, SIMD::cmpge4(SIMD::add4(d, r), zero));
+          }
+          bits |= static_cast<uint32_t>(SIMD::movemask4(inside)) << (i - begin);
+        }
+#endif
+        for (; i < end; ++i) {
+          const Vectors::Vector4& s = spheres[i];
+          if (intersectsSphere(Vectors::Vector3(s.x, s.y, s.z), s.w)) {
+            bits |= 1u << (i - begin);
+          }
+        }
+        return bits;
+      }
+
+      /*
+        *  @brief Visibility bits of boxes [begin, end), at most 32, bit 0 = box begin.
+      */
+      inline uint32_t cullAABBsWord(const AABB* boxes, size_t begin, size_t end) const {
+        uint32_t bits = 0;
+        size_t i = begin;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        SIMD::float4 px[PLANE_COUNT], py[PLANE_COUNT], pz[PLANE_COUNT], pw[PLANE_COUNT];
+        splatPlanes(px, py, pz, pw);
+        SIMD::float4 half = SIMD::splat4(0.5f);
+        for (; i + 4 <= end; i += 4) {
+          // A box is six packed floats: loads at min.x and min.z stay inside it and, after a
+          // transpose, give (min.x, min.y, min.z, -) and (-, max.x, max.y, max.z) for four boxes.
+          SIMD::float4 minX = SIMD::loadu4(&boxes[i].min.x);
+          SIMD::float4 minY = SIMD::loadu4(&boxes[i + 1].min.x);
+          SIMD::float4 minZ = SIMD::loadu4(&boxes[i + 2].min.x);
+          SIMD::float4 unused0 = SIMD::loadu4(&boxes[i + 3].min.x);
+          SIMD::transpose4(minX, minY, minZ, unused0);
+          SIMD::float4 unused1 = SIMD::loadu4(&boxes[i].min.z);
+          SIMD::float4 maxX = SIMD::loadu4(&boxes[i + 1].min.z);
+          SIMD::float4 maxY = SIMD::loadu4(&boxes[i + 2].min.z);
+          SIMD::float4 maxZ = SIMD::loadu4(&boxes[i + 3].min.z);
+          SIMD::transpose4(unused1, maxX, maxY, maxZ);
+
+          SIMD::float4 cx = SIMD::mul4(SIMD::add4(minX, maxX), half);
+          SIMD::float4 cy = SIMD::mul4(SIMD::add4(minY, maxY), half);
+          SIMD::float4 cz = SIMD::mul4(SIMD::add4(minZ, maxZ), half);
+          SIMD::float4 ex = SIMD::mul4(SIMD::sub4(maxX, minX), half);
+          SIMD::float4 ey = SIMD::mul4(SIMD::sub4(maxY, minY), half);
+          SIMD::float4 ez = SIMD::mul4(SIMD::sub4(maxZ, minZ), half);
+          SIMD::float4 zero = SIMD::splat4(0.0f);
+          SIMD::float4 inside = SIMD::cmpge4(zero, zero);
+          for (int p = 0; p < PLANE_COUNT; ++p) {
+            SIMD::float4 d = SIMD::add4(SIMD::add4(SIMD::mul4(px[p], cx), SIMD::mul4(py[p], cy)),
+                                        SIMD::add4(SIMD::mul4(pz[p], cz), pw[p]));
+            SIMD::float4 r = SIMD::add4(SIMD::add4(SIMD::mul4(SIMD::abs4(px[p]), ex), SIMD::mul4(SIMD::abs4(py[p]), ey)),
+                                        SIMD::mul4(SIMD::abs4(pz[p]), ez));
+            inside = SIMD::and4(inside, SIMD::cmpge4(SIMD::add4(d, r), zero));
+          }
+          bits |= static_cast<uint32_t>(SIMD::movemask4(inside)) << (i - begin);
+        }
+#endif
+        for (; i < end; ++i) {
+          if (intersectsAABB(boxes[i])) {
+            bits |= 1u << (i - begin);
+          }
+        }
+        return bits;
+      }
+
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      inline void splatPlanes(SIMD::float4* px, SIMD::float4* py, SIMD::float4* pz, SIMD::float4* pw) const {
+        for (int p = 0; p < PLANE_COUNT; ++p) {
+          px[p] = SIMD::splat4(m_planes[p].x);
+          py[p] = SIMD::splat4(m_planes[p].y);
+          pz[p] = SIMD::splat4(m_planes[p].z);
+          pw[p] = SIMD::splat4(m_planes[p].w);
+        }
+      }
+#endif
+
+      Vectors::Vector4 m_planes[PLANE_COUNT];
+    };
+
+    /*
+      *  @brief Output stream operator for Frustum.
+    */
+    inline std::ostream& operator<<(std::ostream& os, const Frustum& f) {
+      os << "Frustum(";
+      for (int i = 0; i < Frustum::PLANE_COUNT; ++i) {
+        os << (i == 0 ? "" : ", ") << f.plane(i);
+      }
+      os << ")";
+      return os;
+    }
+
+  }
+}
@@ -0,0 +1,304 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "Vector3.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief Static k-d tree over Vector3 points with an implicit, pointer-free layout.
+      *  Every node splits its range of the point array at the middle element (nth_element on the
+      *  axis of largest extent), so the shape of the tree depends on the point count alone: all
+      *  leaves sit at the same depth and hold LEAF_SIZE / 2 to LEAF_SIZE points, node i has
+      *  children 2i + 1 and 2i + 2, and a node's point range is recomputed while descending. The
+      *  tree stores only a split value and axis per interior node next to the reordered points.
+      *  Subtrees larger than PARALLEL_BUILD_THRESHOLD are built on separate threads.
+    */
+    class KDTree {
+    public:
+      /*
+        *  @brief Largest number of points in a leaf bucket.
+      */
+      static constexpr uint32_t LEAF_SIZE = 8;
+
+      /*
+        *  @brief Subtree size above which build() hands the two halves to separate threads.
+      */
+      static constexpr size_t PARALLEL_BUILD_THRESHOLD = 65536;
+
+      /*
+        *  @brief Index reported by queryNearest() when nothing is in range.
+      */
+      static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+      /*
+        *  @brief One query result: original point index and squared distance to the query point.
+      */
+      struct Neighbor {
+        uint32_t index;
+        float squareDistance;
+      };
+
+      inline KDTree() : m_depth(0) {}
+
+      inline size_t size() const { return m_points.size(); }
+      inline bool empty() const { return m_points.empty(); }
+
+      /*
+        *  @brief Rebuilds the tree over n points. Point i of every query is points[i].
+      */
+      inline void build(const Vectors::Vector3* points, size_t n) {
+        m_points.resize(n);
+        Parallel::parallelFor(0, n, PARALLEL_BUILD_THRESHOLD, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            m_points[i] = { points[i], static_cast<uint32_t>(i) };
+          }
+        });
+
+        m_depth = 0;
+        while (((n + (size_t(1) << m_depth) - 1) >> m_depth) > LEAF_SIZE) {
+          ++m_depth;
+        }
+        const size_t interiorCount = (size_t(1) << m_depth) - 1;
+        m_split.resize(interiorCount);
+        m_axis.resize(interiorCount);
+        if (interiorCount != 0) {
+          buildNode(0, 0, static_cast<uint32_t>(n), 0);
+        }
+      }
+
+      /*
+        *  @brief Closest point to center (ties go to the lower index), or { INVALID_INDEX, +inf } if
+        *  nothing lies within maxRadius.
+      */
+      inline Neighbor queryNearest(const Vectors::Vector3& center,
+                                   float maxRadius = std::numeric_limits<float>::infinity()) const {
+        Neighbor best = { INVALID_INDEX, std::numeric_limits<float>::infinity() };
+        KNearest search(center, &best, 1, maxRadius);
+        run(search);
+        return best;
+      }
+
+      /*
+        *  @brief The k points closest to center (at most maxRadius away), nearest first; ties go to
+        *  the lower index.
+        *  @param out Cleared and filled with up to k neighbors.
+        *  @return Number of neighbors found.
+      */
+      inline size_t queryKNearest(const Vectors::Vector3& center, size_t k, std::vector<Neighbor>& out,
+                                  float maxRadius = std::numeric_limits<float>::infinity()) const {
+        out.resize(std::min(k, size()));
+        KNearest search(center, out.data(), out.size(), maxRadius);
+        if (!out.empty()) {
+          run(search);
+        }
+        out.resize(search.count);
+        return out.size();
+      }
+
+      /*
+        *  @brief Calls fn(uint32_t index, float squareDistance) for every point within radius of
+        *  center (boundary included), in no particular order.
+        *  @return Number of points found.
+      */
+      template <typename Fn>
+      inline size_t queryRadius(const Vectors::Vector3& center, float radius, Fn&& fn) const {
+        if (radius < 0.0f) {
+          return 0;
+        }
+        Radius<Fn> search(center, radius * radius, fn);
+        run(search);
+        return search.found;
+      }
+
+      /*
+        *  @brief Appends the indices of every point within radius of center to out.
+        *  @return Number of points found.
+      */
+      inline size_t queryRadius(const Vectors::Vector3& center, float radius, std::vector<uint32_t>& out) const {
+        return queryRadius(center, radius, [&out](uint32_t index, float) { out.push_back(index); });
+      }
+
+      /*
+        *  @brief queryNearest() for n query points, split across threads.
+      */
+      inline void queryNearestBatch(const Vectors::Vector3* queries, size_t n, Neighbor* out,
+                                    float maxRadius = std::numeric_limits<float>::infinity()) const {
+        Parallel::parallelFor(0, n, BATCH_PARALLEL_THRESHOLD, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            out[i] = queryNearest(queries[i], maxRadius);
+          }
+        });
+      }
+
+    private:
+      static constexpr size_t BATCH_PARALLEL_THRESHOLD = 1024;
+
+      struct Entry {
+        Vectors::Vector3 position;
+        uint32_t index;
+      };
+
+      static inline float coordinate(const Vectors::Vector3& p, int axis) {
+        return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+      }
+
+      static inline bool closer(const Neighbor& a, const Neighbor& b) {
+        return a.squareDistance < b.squareDistance || (a.squareDistance == b.squareDistance && a.index < b.index);
+      }
+
+      /*
+        *  @brief Query state for the k-nearest search: best[0, count) sorted with closer().
+      */
+      struct KNearest {
+        Vectors::Vector3 center;
+        Neighbor* best;
+        size_t k;
+        size_t count;
+        float limitSq;
+
+        inline KNearest(const Vectors::Vector3& p, Neighbor* out, size_t maxCount, float maxRadius)
+          : center(p), best(out), k(maxCount), count(0), limitSq(maxRadius < 0.0f ? -1.0f : maxRadius * maxRadius) {}
+
+        inline void visit(uint32_t index, float squareDistance) {
+          Neighbor candidate = { index, squareDistance };
+          if (count == k && !closer(candidate, best[k - 1])) {
+            return;
+          }
+          size_t i = count < k ? count++ : k - 1;
+          for (; i > 0 && closer(candidate, best[i - 1]); --i) {
+            best[i] = best[i - 1];
+          }
+          best[i] = candidate;
+          if (count == k) {
+            limitSq = best[k - 1].squareDistance;
+          }
+        }
+      };
+
+      template <typename Fn>
+      struct Radius {
+        Vectors::Vector3 center;
+        float limitSq;
+        Fn& fn;
+        size_t found;
+
+        inline Radius(const Vectors::Vector3& p, float radiusSq, Fn& callback)
+          : center(p), limitSq(radiusSq), fn(callback), found(0) {}
+
+        inline void visit(uint32_t index, float squareDistance) {
+          fn(index, squareDistance);
+          ++found;
+        }
+      };
+
+      template <typename Search>
+      inline void run(Search& search) const {
+        if (m_points.empty() || search.limitSq < 0.0f) {
+          return;
+        }
+        float offset[3] = { 0.0f, 0.0f, 0.0f };
+        searchNode(search, 0, 0, static_cast<uint32_t>(m_points.size()), 0, 0.0f, offset);
+      }
+
+      /*
+        *  @brief Descends near child first; the far child is entered only if the squared distance
+        *  from the query to its region, kept incrementally per axis in offset, is within the
+        *  search limit.
+      */
+      template <typename Search>
+      inline void searchNode(Search& search, uint32_t node, uint32_t begin, uint32_t end, int depth,
+                             float regionSq, float* offset) const {
+        if (depth == m_depth) {
+          for (uint32_t i = begin; i < end; ++i) {
+            const Entry& entry = m_points[i];
+            const float dx = entry.position.x - search.center.x;
+            const float dy = entry.position.y - search.center.y;
+            const float dz = entry.position.z - search.center.z;
+            const float squareDistance = dx * dx + dy * dy + dz * dz;
+            if (squareDistance <= search.limitSq) {
+              search.visit(entry.index, squareDistance);
+            }
+          }
+          return;
+        }
+
+        const int axis = m_axis[node];
+        const uint32_t mid = begin + (end - begin) / 2;
+        const float diff = coordinate(search.center, axis) - m_split[node];
+        if (diff < 0.0f) {
+          searchNode(search, 2 * node + 1, begin, mid, depth + 1, regionSq, offset);
+        }
+        else {
+          searchNode(search, 2 * node + 2, mid, end, depth + 1, regionSq, offset);
+        }
+
+        const float previous = offset[axis];
+        const float farSq = regionSq - previous * previous + diff * diff;
+        if (farSq <= search.limitSq) {
+          offset[axis] = diff;
+          if (diff < 0.0f) {
+            searchNode(search, 2 * node + 2, mid, end, depth + 1, farSq, offset);
+          }
+          else {
+            searchNode(search, 2 * node + 1, begin, mid, depth + 1, farSq, offset);
+          }
+          offset[axis] = previous;
+        }
+      }
+
+      inline void buildNode(uint32_t node, uint32_t begin, uint32_t end, int depth) {
+        if (depth == m_depth) {
+          return;
+        }
+
+        Vectors::Vector3 lo = m_points[begin].position, hi = lo;
+        for (uint32_t i = begin + 1; i < end; ++i) {
+          const Vectors::Vector3& p = m_points[i].position;
+          lo = Vectors::Vector3(Math::EMin(lo.x, p.x), Math::EMin(lo.y, p.y), Math::EMin(lo.z, p.z));
+          hi = Vectors::Vector3(Math::EMax(hi.x, p.x), Math::EMax(hi.y, p.y), Math::EMax(hi.z, p.z));
+        }
+        const Vectors::Vector3 extent = hi - lo;
+        const int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+        const uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(m_points.begin() + begin, m_points.begin() + mid, m_points.begin() + end,
+                         [axis](const Entry& a, const Entry& b) {
+                           return coordinate(a.position, axis) < coordinate(b.position, axis);
+                         });
+        m_split[node] = coordinate(m_points[mid].position, axis);
+        m_axis[node] = static_cast<uint8_t>(axis);
+
+        if (end - begin > PARALLEL_BUILD_THRESHOLD) {
+          Parallel::parallelFor(0, 2, 1, [&](size_t first, size_t last) {
+            for (size_t child = first; child < last; ++child) {
+              if (child == 0) {
+                buildNode(2 * node + 1, begin, mid, depth + 1);
+              }
+              else {
+                buildNode(2 * node + 2, mid, end, depth + 1);
+              }
+            }
+          });
+        }
+        else {
+          buildNode(2 * node + 1, begin, mid, depth + 1);
+          buildNode(2 * node + 2, mid, end, depth + 1);
+        }
+      }
+
+      int m_depth;
+      std::vector<Entry> m_points;
+      std::vector<float> m_split;
+      std::vector<uint8_t> m_axis;
+    };
+
+  }
+}
@@ -48,6 +48,14 @@ int main() {
   std::cout << "Muestra sin(180 deg): " << EngineUtilities::Math::sin(angle_180_deg) << " (esperado 0.0000)" << std::endl;
   std::cout << "Muestra cos(180 deg): " << EngineUtilities::Math::cos(angle_180_deg) << " (esperado -1.0000)" << std::endl;
 
+  float sin_30, cos_30;
+  EngineUtilities::Math::sincos(angle_30_deg, &sin_30, &cos_30);
+  std::cout << "Muestra sincos(30 deg): " << sin_30 << ", " << cos_30 << " (esperado 0.5000, 0.8660)" << std::endl;
+  std::cout << "Muestra sin(30 deg) rapido: " << EngineUtilities::Math::sin(angle_30_deg, EngineUtilities::Math::TrigAccuracy::Fast) << " (esperado 0.5000)" << std::endl;
+  constexpr float sqrt2_const = EngineUtilities::Math::sqrt(2.0f);
+  constexpr float sin30_const = EngineUtilities::Math::sin(EngineUtilities::Math::radians(30.0f));
+  std::cout << "Muestra constexpr sqrt(2), sin(30 deg): " << sqrt2_const << ", " << sin30_const << " (esperado 1.4142, 0.5000)" << std::endl;
+
   std::cout << "\n--- Pruebas de Math Inverse Trig ---\n";
   std::cout << "Muestra asin(0.5): " << EngineUtilities::Math::degrees(EngineUtilities::Math::asin(0.5f)) << " deg (esperado 30.0000)\n";
   std::cout << "Muestra acos(0.5): " << EngineUtilities::Math::degrees(EngineUtilities::Math::acos(0.5f)) << " deg (esperado 60.0000)\n";
@@ -130,5 +138,35 @@ int main() {
   std::cout << "Cuaternin original (" << q_from_axis_angle << ") -> Eje: " << extracted_axis
     << ", Angulo: " << EngineUtilities::Math::degrees(extracted_angle) << " deg" << std::endl;
 
+  std::cout << "\n--- Tipos double / half ---" << std::endl;
+
+  EngineUtilities::Rotations::Quaterniond qd(EngineUtilities::Vectors::Vector3d(0.0, 0.0, 1.0), 1.0e-4);
+  EngineUtilities::Vectors::Vector3d vd = qd * EngineUtilities::Vectors::Vector3d(1.0e6, 0.0, 0.0);
+  std::cout.precision(12);
+  std::cout << "Rotacion double de (1e6,0,0) por 1e-4 rad: " << vd << std::endl;
+  std::cout.precision(6);
+
+  EngineUtilities::Vectors::Vector4h vh(1.0f, 0.5f, 0.25f, 0.125f);
+  std::cout << "Vector4h (" << sizeof(vh) << " bytes): " << vh * 2.0f << std::endl;
+
+  std::cout << "\n--- Distancias ---" << std::endl;
+
+  // points[4] repeats points[2] and falls outside the 4-point SIMD blocks: the tie must go to 2.
+  EngineUtilities::Vectors::Vector3 target(-3.7f, 8.1f, -0.7f);
+  EngineUtilities::Vectors::Vector3 points[5] = {
+    EngineUtilities::Vectors::Vector3(4.1f, 2.5f, -1.9f), EngineUtilities::Vectors::Vector3(-1.0f, 1.0f, 7.5f),
+    EngineUtilities::Vectors::Vector3(-0.7f, 5.7f, -1.0f), EngineUtilities::Vectors::Vector3(3.1f, -7.9f, -0.9f),
+    EngineUtilities::Vectors::Vector3(-0.7f, 5.7f, -1.0f)
+  };
+  std::cout << "nearestOf / nearestOfBatch con punto repetido: " << target.nearestOf(points, 5) << ", "
+    << EngineUtilities::Vectors::nearestOfBatch(target, points, 5) << " (esperado 2, 2)" << std::endl;
+
+  std::cout << "\n--- Matriz4x4 inversa con escala pequena ---" << std::endl;
+
+  // A centimetre-scale model matrix has det 8e-6; it must still invert instead of returning identity.
+  EngineUtilities::Matrices::Matriz4x4 small_scale = EngineUtilities::Matrices::Matriz4x4::createScale(EngineUtilities::Vectors::Vector3(0.02f, 0.02f, 0.02f));
+  std::cout << "createScale(0.02).inverse()[0][0], inverseAffine()[0][0]: " << small_scale.inverse().m[0][0] << ", "
+    << small_scale.inverseAffine().m[0][0] << " (esperado 50, 50)" << std::endl;
+
   return 0;
 }
\ No newline at end of file
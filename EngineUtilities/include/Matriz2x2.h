@@ -1,8 +1,9 @@
 #pragma once
 
-#include "EngineUtilites.h"
+#include <iostream>
 #include "EngineMath.h"
 #include "Vector2.h" 
+#include <type_traits>
 
 namespace EngineUtilities {
 namespace Matriz {
@@ -19,7 +20,7 @@ namespace Matriz {
     /*
     *  @brief Default constructor. Initializes as identity matrix.
     */
-    inline Matriz2x2() {
+    constexpr Matriz2x2() : m{} {
       m[0][0] = 1.0f; m[0][1] = 0.0f;
       m[1][0] = 0.0f; m[1][1] = 1.0f;
     }
@@ -31,33 +32,19 @@ namespace Matriz {
     *  @param c1r0 Value for column 1, row 0.
     *  @param c1r1 Value for column 1, row 1.
     */
-    inline Matriz2x2(float c0r0, float c0r1,
-      float c1r0, float c1r1) {
+    constexpr Matriz2x2(float c0r0, float c0r1,
+      float c1r0, float c1r1) : m{} {
       m[0][0] = c0r0; m[0][1] = c0r1;
       m[1][0] = c1r0; m[1][1] = c1r1;
     }
 
-    /*
-    *  @brief Assignment operator.
-    *  @param other Matrix to copy from.
-    *  @return Reference to this matrix.
-    */
-    inline Matriz2x2& operator=(const Matriz2x2& other) {
-      for (int i = 0; i < 2; ++i) {
-        for (int j = 0; j < 2; ++j) {
-          m[i][j] = other.m[i][j];
-        }
-      }
-      return *this;
-    }
-
     /*
     *  @brief Equality operator.
     *  @param other Matrix to compare.
     *  @return True if matrices are approximately equal.
     */
 
-    inline
+    constexpr
       bool operator==(const Matriz2x2& other) const {
       for (int i = 0; i < 2; ++i) {
         for (int j = 0; j < 2; ++j) {
@@ -74,7 +61,7 @@ namespace Matriz {
     *  @param other Matrix to compare.
     *  @return True if matrices are not equal.
     */
-    inline bool operator!=(const Matriz2x2& other) const {
+    constexpr bool operator!=(const Matriz2x2& other) const {
       return !(*this == other);
     }
 
@@ -83,7 +70,7 @@ namespace Matriz {
     *  @param other Matrix to add.
     *  @return Resulting matrix.
     */
-    inline Matriz2x2 operator+(const Matriz2x2& other) const {
+    constexpr Matriz2x2 operator+(const Matriz2x2& other) const {
       Matriz2x2 result;
       for (int i = 0; i < 2; ++i) {
         for (int j = 0; j < 2; ++j) {
@@ -98,7 +85,7 @@ namespace Matriz {
     *  @param other Matrix to subtract.
     *  @return Resulting matrix.
     */
-    inline Matriz2x2 operator-(const Matriz2x2& other) const {
+    constexpr Matriz2x2 operator-(const Matriz2x2& other) const {
       Matriz2x2 result;
       for (int i = 0; i < 2; ++i) {
         for (int j = 0; j < 2; ++j) {
@@ -113,7 +100,7 @@ namespace Matriz {
     *  @param scalar Value to multiply each element.
     *  @return Resulting matrix.
     */
-    inline Matriz2x2 operator*(float scalar) const {
+    constexpr Matriz2x2 operator*(float scalar) const {
       Matriz2x2 result;
       for (int i = 0; i < 2; ++i) {
         for (int j = 0; j < 2; ++j) {
@@ -128,7 +115,7 @@ namespace Matriz {
     *  @param other Matrix to multiply.
     *  @return Resulting matrix.
     */
-    inline Matriz2x2 operator*(const Matriz2x2& other) const {
+    constexpr Matriz2x2 operator*(const Matriz2x2& other) const {
       Matriz2x2 result;
       result.m[0][0] = m[0][0] * other.m[0][0] + m[1][0] * other.m[0][1];
       result.m[0][1] = m[0][1] * other.m[0][0] + m[1][1] * other.m[0][1];
@@ -143,7 +130,7 @@ namespace Matriz {
     *  @param vec Vector to multiply.
     *  @return Resulting vector.
     */
-    inline Vectors::Vector2 operator*(const Vectors::Vector2& vec) const {
+    constexpr Vectors::Vector2 operator*(const Vectors::Vector2& vec) const {
       return Vectors::Vector2(
         m[0][0] * vec.x + m[1][0] * vec.y, // m00*x + m10*y
         m[0][1] * vec.x + m[1][1] * vec.y  // m01*x + m11*y
@@ -155,7 +142,7 @@ namespace Matriz {
     *  @param other Matrix to add.
     *  @return Reference to this matrix.
     */
-    inline Matriz2x2& operator+=(const Matriz2x2& other) {
+    constexpr Matriz2x2& operator+=(const Matriz2x2& other) {
       *this = *this + other;
       return *this;
     }
@@ -165,7 +152,7 @@ namespace Matriz {
     *  @param other Matrix to subtract.
     *  @return Reference to this matrix.
     */
-    inline Matriz2x2& operator-=(const Matriz2x2& other) {
+    constexpr Matriz2x2& operator-=(const Matriz2x2& other) {
       *this = *this - other;
       return *this;
     }
@@ -175,7 +162,7 @@ namespace Matriz {
     *  @param scalar Value to multiply.
     *  @return Reference to this matrix.
     */
-    inline Matriz2x2& operator*=(float scalar) {
+    constexpr Matriz2x2& operator*=(float scalar) {
       *this = *this * scalar;
       return *this;
     }
@@ -185,7 +172,7 @@ namespace Matriz {
     *  @param other Matrix to multiply.
     *  @return Reference to this matrix.
     */
-    inline Matriz2x2& operator*=(const Matriz2x2& other) {
+    constexpr Matriz2x2& operator*=(const Matriz2x2& other) {
       *this = *this * other;
       return *this;
     }
@@ -194,7 +181,7 @@ namespace Matriz {
     *  @brief Returns the identity matrix.
     *  @return Identity matrix.
     */
-    static inline Matriz2x2 Identity() {
+    static constexpr Matriz2x2 Identity() {
       return Matriz2x2(1.0f, 0.0f,
         0.0f, 1.0f);
     }
@@ -203,7 +190,7 @@ namespace Matriz {
     *  @brief Calculates the determinant of the matrix.
     *  @return Determinant value.
     */
-    inline float determinant() const {
+    constexpr float determinant() const {
       return m[0][0] * m[1][1] - m[0][1] * m[1][0];
     }
 
@@ -211,7 +198,7 @@ namespace Matriz {
     *  @brief Returns the transposed matrix.
     *  @return Transposed matrix.
     */
-    inline Matriz2x2 transposed() const {
+    constexpr Matriz2x2 transposed() const {
       return Matriz2x2(m[0][0], m[1][0],
         m[0][1], m[1][1]);
     }
@@ -220,7 +207,7 @@ namespace Matriz {
 *  @brief Returns the inverse of the matrix.
 *  @return Inverse matrix, or identity if not invertible.
 */
-  inline Matriz2x2 inverse() const {
+  constexpr Matriz2x2 inverse() const {
     float det = determinant();
       if (Math::abs(det) < Math::EPSILON) {
         return Identity();
@@ -234,9 +221,9 @@ namespace Matriz {
 *  @param angle_rad Angle in radians.
 *  @return Rotation matrix.
 */
-  static inline Matriz2x2 Rotation(float angle_rad) {
-    float c = Math::cos(angle_rad);
-    float s = Math::sin(angle_rad);
+  static constexpr Matriz2x2 Rotation(float angle_rad) {
+    float s = 0.0f, c = 0.0f;
+    Math::sincos(angle_rad, &s, &c);
       return Matriz2x2(c, s,-s, c);
   }
 
@@ -246,7 +233,7 @@ namespace Matriz {
 *  @param sy Scale factor for Y.
 *  @return Scaling matrix.
 */
-  static inline Matriz2x2 Scale(float sx, float sy) {
+  static constexpr Matriz2x2 Scale(float sx, float sy) {
     return Matriz2x2(sx, 0.0f,0.0f, sy);
   }
 
@@ -255,18 +242,23 @@ namespace Matriz {
 *  @param scaleVec Vector containing scale factors.
 *  @return Scaling matrix.
 */
-  static inline Matriz2x2 Scale(const Vectors::Vector2& scaleVec) {
+  static constexpr Matriz2x2 Scale(const Vectors::Vector2& scaleVec) {
     return Scale(scaleVec.x, scaleVec.y);
   }
 };
 
+static_assert(std::is_trivially_copyable<Matriz2x2>::value, "Matriz2x2 must be trivially copyable");
+static_assert(std::is_standard_layout<Matriz2x2>::value, "Matriz2x2 must be standard layout");
+static_assert(sizeof(Matriz2x2) == 4 * sizeof(float), "Matriz2x2 must stay four packed floats");
+static_assert(alignof(Matriz2x2) == alignof(float), "Matriz2x2 must keep float alignment");
+
 /*
 *  @brief Scalar multiplication (commutative).
 *  @param scalar Value to multiply.
 *  @param mat Matrix to multiply.
 *  @return Resulting matrix.
 */
-  inline Matriz2x2 operator*(float scalar, const Matriz2x2& mat) {
+  constexpr Matriz2x2 operator*(float scalar, const Matriz2x2& mat) {
     return mat * scalar;
   }
 /*
@@ -2,25 +2,35 @@
 #pragma once
 
 #include "EngineMath.h"
+#include "EngineParallel.h"
 #include "Vector3.h" 
 #include "Matriz2x2.h"      
+#include <cstddef>
+#include <type_traits>
 
 namespace EngineUtilities {
   namespace Matriz {
 
     /*
       *  @brief Structure representing a 3x3 matrix with basic operations.
+      *  Templated over the element type; Matriz3x3 is the float matrix, Matriz3x3d the double one.
     */
-    struct Matriz3x3 {
+    template <typename T>
+    struct TMatriz3x3 {
+      /*
+        *  @brief Element type.
+      */
+      using value_type = T;
+
       /*
         *  @brief Matrix elements stored in column-major order.
       */
-      float m[3][3]; 
+      T m[3][3]; 
 
       /*
         *  @brief Default constructor. Initializes as identity matrix.
       */
-      inline Matriz3x3() {
+      constexpr TMatriz3x3() : m{} {
         m[0][0] = 1.0f; m[0][1] = 0.0f; m[0][2] = 0.0f;
         m[1][0] = 0.0f; m[1][1] = 1.0f; m[1][2] = 0.0f;
         m[2][0] = 0.0f; m[2][1] = 0.0f; m[2][2] = 1.0f;
@@ -38,34 +48,20 @@ namespace EngineUtilities {
         *  @param c2r1 Value for column 2, row 1.
         *  @param c2r2 Value for column 2, row 2.
       */
-      inline Matriz3x3(float c0r0, float c0r1, float c0r2,
-        float c1r0, float c1r1, float c1r2,
-        float c2r0, float c2r1, float c2r2) {
+      constexpr TMatriz3x3(T c0r0, T c0r1, T c0r2,
+        T c1r0, T c1r1, T c1r2,
+        T c2r0, T c2r1, T c2r2) : m{} {
         m[0][0] = c0r0; m[0][1] = c0r1; m[0][2] = c0r2;
         m[1][0] = c1r0; m[1][1] = c1r1; m[1][2] = c1r2;
         m[2][0] = c2r0; m[2][1] = c2r1; m[2][2] = c2r2;
       }
 
-      /*
-        *  @brief Assignment operator.
-        *  @param other Matrix to copy from.
-        *  @return Reference to this matrix.
-      */
-      inline Matriz3x3& operator=(const Matriz3x3& other) {
-        for (int i = 0; i < 3; ++i) {
-          for (int j = 0; j < 3; ++j) {
-            m[i][j] = other.m[i][j];
-          }
-        }
-        return *this;
-      }
-
       /*
         *  @brief Equality operator.
         *  @param other Matrix to compare.
         *  @return True if matrices are approximately equal.
       */
-      inline bool operator==(const Matriz3x3& other) const {
+      constexpr bool operator==(const TMatriz3x3& other) const {
         for (int i = 0; i < 3; ++i) {
           for (int j = 0; j < 3; ++j) {
             if (!Math::approxEqual(m[i][j], other.m[i][j])) {
@@ -81,7 +77,7 @@ namespace EngineUtilities {
         *  @param other Matrix to compare.
         *  @return True if matrices are not equal.
       */
-      inline bool operator!=(const Matriz3x3& other) const {
+      constexpr bool operator!=(const TMatriz3x3& other) const {
         return !(*this == other);
       }
 
@@ -90,8 +86,8 @@ namespace EngineUtilities {
         *  @param other Matrix to add.
         *  @return Resulting matrix.
       */
-      inline Matriz3x3 operator+(const Matriz3x3& other) const {
-        Matriz3x3 result;
+      constexpr TMatriz3x3 operator+(const TMatriz3x3& other) const {
+        TMatriz3x3 result;
         for (int i = 0; i < 3; ++i) {
           for (int j = 0; j < 3; ++j) {
             result.m[i][j] = m[i][j] + other.m[i][j];
@@ -105,8 +101,8 @@ namespace EngineUtilities {
         *  @param other Matrix to subtract.
         *  @return Resulting matrix.
       */
-      inline Matriz3x3 operator-(const Matriz3x3& other) const {
-        Matriz3x3 result;
+      constexpr TMatriz3x3 operator-(const TMatriz3x3& other) const {
+        TMatriz3x3 result;
         for (int i = 0; i < 3; ++i) {
           for (int j = 0; j < 3; ++j) {
             result.m[i][j] = m[i][j] - other.m[i][j];
@@ -120,8 +116,8 @@ namespace EngineUtilities {
         *  @param scalar Value to multiply each element.
         *  @return Resulting matrix.
       */
-      inline Matriz3x3 operator*(float scalar) const {
-        Matriz3x3 result;
+      constexpr TMatriz3x3 operator*(T scalar) const {
+        TMatriz3x3 result;
         for (int i = 0; i < 3; ++i) {
           for (int j = 0; j < 3; ++j) {
             result.m[i][j] = m[i][j] * scalar;
@@ -135,8 +131,8 @@ namespace EngineUtilities {
         *  @param other Matrix to multiply.
         *  @return Resulting matrix.
       */
-      inline Matriz3x3 operator*(const Matriz3x3& other) const {
-        Matriz3x3 result;
+      constexpr TMatriz3x3 operator*(const TMatriz3x3& other) const {
+        TMatriz3x3 result;
         for (int r = 0; r < 3; ++r) { 
           for (int c = 0; c < 3; ++c) {
             result.m[c][r] = m[0][r] * other.m[c][0] +
@@ -152,8 +148,8 @@ namespace EngineUtilities {
         *  @param vec Vector to multiply.
         *  @return Resulting vector.
       */
-      inline Vectors::Vector3 operator*(const Vectors::Vector3& vec) const {
-        return Vectors::Vector3(
+      constexpr Vectors::TVector3<T> operator*(const Vectors::TVector3<T>& vec) const {
+        return Vectors::TVector3<T>(
           m[0][0] * vec.x + m[1][0] * vec.y + m[2][0] * vec.z,
           m[0][1] * vec.x + m[1][1] * vec.y + m[2][1] * vec.z,
           m[0][2] * vec.x + m[1][2] * vec.y + m[2][2] * vec.z
@@ -165,7 +161,7 @@ namespace EngineUtilities {
         *  @param other Matrix to add.
         *  @return Reference to this matrix.
       */
-      inline Matriz3x3& operator+=(const Matriz3x3& other) {
+      constexpr TMatriz3x3& operator+=(const TMatriz3x3& other) {
         *this = *this + other;
         return *this;
       }
@@ -175,7 +171,7 @@ namespace EngineUtilities {
         *  @param other Matrix to subtract.
         *  @return Reference to this matrix.
       */
-      inline Matriz3x3& operator-=(const Matriz3x3& other) {
+      constexpr TMatriz3x3& operator-=(const TMatriz3x3& other) {
         *this = *this - other;
         return *this;
       }
@@ -185,7 +181,7 @@ namespace EngineUtilities {
         *  @param scalar Value to multiply.
         *  @return Reference to this matrix.
       */
-      inline Matriz3x3& operator*=(float scalar) {
+      constexpr TMatriz3x3& operator*=(T scalar) {
         *this = *this * scalar;
         return *this;
       }
@@ -195,7 +191,7 @@ namespace EngineUtilities {
         *  @param other Matrix to multiply.
         *  @return Reference to this matrix.
       */
-      inline Matriz3x3& operator*=(const Matriz3x3& other) {
+      constexpr TMatriz3x3& operator*=(const TMatriz3x3& other) {
         *this = *this * other;
         return *this;
       }
@@ -204,8 +200,8 @@ namespace EngineUtilities {
         *  @brief Returns the identity matrix.
         *  @return Identity matrix.
       */
-      static inline Matriz3x3 Identity() {
-        return Matriz3x3(1.0f, 0.0f, 0.0f,
+      static constexpr TMatriz3x3 Identity() {
+        return TMatriz3x3(1.0f, 0.0f, 0.0f,
           0.0f, 1.0f, 0.0f,
           0.0f, 0.0f, 1.0f);
       }
@@ -216,37 +212,29 @@ namespace EngineUtilities {
         *  @param col Column index.
         *  @return Cofactor value.
       */
-      inline float cofactor(int row, int col) const {
-        Matriz2x2 submatrix;
-        int sub_r = 0, sub_c = 0;
-        for (int r = 0; r < 3; ++r) {
-          if (r == row) continue;
-          sub_c = 0;
-          for (int c = 0; c < 3; ++c) {
-            if (c == col) continue;
-            submatrix.m[sub_c][sub_r] = m[c][r]; 
-            sub_c++;
-          }
-          sub_r++;
-        }
-        float det_sub = submatrix.determinant();
+      constexpr T cofactor(int row, int col) const {
+        int r0 = (row == 0) ? 1 : 0, r1 = (row == 2) ? 1 : 2;
+        int c0 = (col == 0) ? 1 : 0, c1 = (col == 2) ? 1 : 2;
+        T det_sub = m[c0][r0] * m[c1][r1] - m[c1][r0] * m[c0][r1];
         return ((row + col) % 2 == 0) ? det_sub : -det_sub;
       }
 
       /*
-        *  @brief Calculates the determinant of the matrix.
+        *  @brief Calculates the determinant of the matrix (closed form, triple product of the columns).
         *  @return Determinant value.
       */
-      inline float determinant() const {
-        return m[0][0] * cofactor(0, 0) + m[1][0] * cofactor(0, 1) + m[2][0] * cofactor(0, 2);
+      constexpr T determinant() const {
+        return m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
+             - m[1][0] * (m[0][1] * m[2][2] - m[2][1] * m[0][2])
+             + m[2][0] * (m[0][1] * m[1][2] - m[1][1] * m[0][2]);
       }
 
       /*
         *  @brief Returns the transposed matrix.
         *  @return Transposed matrix.
       */
-      inline Matriz3x3 transposed() const {
-        Matriz3x3 result;
+      constexpr TMatriz3x3 transposed() const {
+        TMatriz3x3 result;
         for (int i = 0; i < 3; ++i) {
           for (int j = 0; j < 3; ++j) {
             result.m[j][i] = m[i][j]; 
@@ -259,25 +247,52 @@ namespace EngineUtilities {
         *  @brief Returns the adjugate matrix.
         *  @return Adjugate matrix.
       */
-      inline Matriz3x3 adjugate() const {
-        Matriz3x3 adj;
-        adj.m[0][0] = cofactor(0, 0); adj.m[1][0] = cofactor(0, 1); adj.m[2][0] = cofactor(0, 2);
-        adj.m[0][1] = cofactor(1, 0); adj.m[1][1] = cofactor(1, 1); adj.m[2][1] = cofactor(1, 2);
-        adj.m[0][2] = cofactor(2, 0); adj.m[1][2] = cofactor(2, 1); adj.m[2][2] = cofactor(2, 2);
-        return adj.transposed();
+      constexpr TMatriz3x3 adjugate() const {
+        // Rows of the adjugate are the cross products of column pairs.
+        return TMatriz3x3(
+          m[1][1] * m[2][2] - m[1][2] * m[2][1], m[2][1] * m[0][2] - m[2][2] * m[0][1], m[0][1] * m[1][2] - m[0][2] * m[1][1],
+          m[1][2] * m[2][0] - m[1][0] * m[2][2], m[2][2] * m[0][0] - m[2][0] * m[0][2], m[0][2] * m[1][0] - m[0][0] * m[1][2],
+          m[1][0] * m[2][1] - m[1][1] * m[2][0], m[2][0] * m[0][1] - m[2][1] * m[0][0], m[0][0] * m[1][1] - m[0][1] * m[1][0]);
       }
 
       /*
-        *  @brief Returns the inverse of the matrix.
+        *  @brief Returns the inverse and the determinant, computing the cofactors only once.
+        *  @param outDeterminant Receives the determinant.
         *  @return Inverse matrix, or identity if not invertible.
       */
-      inline Matriz3x3 inverse() const {
-        float det = determinant();
-        if (Math::abs(det) < Math::EPSILON) {
+      constexpr TMatriz3x3 inverse(T& outDeterminant) const {
+        TMatriz3x3 adj = adjugate();
+        // Row 0 of the matrix dotted with column 0 of its adjugate.
+        T det = m[0][0] * adj.m[0][0] + m[1][0] * adj.m[0][1] + m[2][0] * adj.m[0][2];
+        outDeterminant = det;
+        if (Math::abs(det) < Math::Constants<T>::EPSILON) {
           return Identity();
         }
-        Matriz3x3 adj = adjugate();
-        return adj * (1.0f / det);
+        T invDet = 1.0f / det;
+        for (int i = 0; i < 3; ++i) {
+          for (int j = 0; j < 3; ++j) {
+            adj.m[i][j] *= invDet;
+          }
+        }
+        return adj;
+      }
+
+      /*
+        *  @brief Returns the inverse of the matrix.
+        *  @return Inverse matrix, or identity if not invertible.
+      */
+      constexpr TMatriz3x3 inverse() const {
+        T det = 0.0f;
+        return inverse(det);
+      }
+
+      /*
+        *  @brief Returns the inverse-transpose (normal matrix): cofactor matrix / determinant.
+        *  @return Inverse-transpose matrix, or identity if not invertible.
+      */
+      constexpr TMatriz3x3 inverseTransposed() const {
+        T det = 0.0f;
+        return inverse(det).transposed();
       }
 
       /*
@@ -285,10 +300,10 @@ namespace EngineUtilities {
         *  @param angle_rad Angle in radians.
         *  @return Rotation matrix.
       */
-      static inline Matriz3x3 RotationX(float angle_rad) {
-        float c = Math::cos(angle_rad);
-        float s = Math::sin(angle_rad);
-        return Matriz3x3(1.0f, 0.0f, 0.0f,
+      static constexpr TMatriz3x3 RotationX(T angle_rad) {
+        T s = 0.0f, c = 0.0f;
+        Math::sincos(angle_rad, &s, &c);
+        return TMatriz3x3(1.0f, 0.0f, 0.0f,
           0.0f, c, s,
           0.0f, -s, c);
       }
@@ -298,10 +313,10 @@ namespace EngineUtilities {
         *  @param angle_rad Angle in radians.
         *  @return Rotation matrix.
       */
-      static inline Matriz3x3 RotationY(float angle_rad) {
-        float c = Math::cos(angle_rad);
-        float s = Math::sin(angle_rad);
-        return Matriz3x3(c, 0.0f, -s,
+      static constexpr TMatriz3x3 RotationY(T angle_rad) {
+        T s = 0.0f, c = 0.0f;
+        Math::sincos(angle_rad, &s, &c);
+        return TMatriz3x3(c, 0.0f, -s,
           0.0f, 1.0f, 0.0f,
           s, 0.0f, c);
       }
@@ -311,10 +326,10 @@ namespace EngineUtilities {
         *  @param angle_rad Angle in radians.
         *  @return Rotation matrix.
       */
-      static inline Matriz3x3 RotationZ(float angle_rad) {
-        float c = Math::cos(angle_rad);
-        float s = Math::sin(angle_rad);
-        return Matriz3x3(c, s, 0.0f,
+      static constexpr TMatriz3x3 RotationZ(T angle_rad) {
+        T s = 0.0f, c = 0.0f;
+        Math::sincos(angle_rad, &s, &c);
+        return TMatriz3x3(c, s, 0.0f,
           -s, c, 0.0f,
           0.0f, 0.0f, 1.0f);
       }
@@ -326,8 +341,8 @@ namespace EngineUtilities {
         *  @param sz Scale factor for Z.
         *  @return Scaling matrix.
       */
-      static inline Matriz3x3 Scale(float sx, float sy, float sz) {
-        return Matriz3x3(sx, 0.0f, 0.0f,
+      static constexpr TMatriz3x3 Scale(T sx, T sy, T sz) {
+        return TMatriz3x3(sx, 0.0f, 0.0f,
           0.0f, sy, 0.0f,
           0.0f, 0.0f, sz);
       }
@@ -337,20 +352,55 @@ namespace EngineUtilities {
         *  @param scaleVec Vector containing scale factors.
         *  @return Scaling matrix.
       */
-      static inline Matriz3x3 Scale(const Vectors::Vector3& scaleVec) {
+      static constexpr TMatriz3x3 Scale(const Vectors::TVector3<T>& scaleVec) {
         return Scale(scaleVec.x, scaleVec.y, scaleVec.z);
       }
     };
 
+    using Matriz3x3 = TMatriz3x3<float>;
+    using Matriz3x3d = TMatriz3x3<double>;
+
+    static_assert(std::is_trivially_copyable<Matriz3x3>::value, "Matriz3x3 must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Matriz3x3d>::value, "Matriz3x3d must be trivially copyable");
+    static_assert(std::is_standard_layout<Matriz3x3>::value, "Matriz3x3 must be standard layout");
+    static_assert(std::is_standard_layout<Matriz3x3d>::value, "Matriz3x3d must be standard layout");
+    static_assert(sizeof(Matriz3x3) == 9 * sizeof(float), "Matriz3x3 must stay nine packed floats");
+    static_assert(sizeof(Matriz3x3d) == 9 * sizeof(double), "Matriz3x3d must stay nine packed doubles");
+    static_assert(alignof(Matriz3x3) == alignof(float), "Matriz3x3 must keep float alignment");
+
     /*
       *  @brief Scalar multiplication (commutative).
       *  @param scalar Value to multiply.
       *  @param mat Matrix to multiply.
       *  @return Resulting matrix.
     */
-    inline Matriz3x3 operator*(float scalar, const Matriz3x3& mat) {
+    template <typename T>
+    constexpr TMatriz3x3<T> operator*(typename TMatriz3x3<T>::value_type scalar, const TMatriz3x3<T>& mat) {
       return mat * scalar;
     }
 
+    /*
+      *  @brief Batch size below which inverseBatch stays on the calling thread.
+    */
+    const 
+      size_t INVERSE_BATCH_PARALLEL_THRESHOLD = 8192;
+
+    /*
+      *  @brief Computes out[i] = in[i].inverse() for n matrices (fused closed form, split across
+      *  threads for large n). out may alias in.
+      *  @param in Source matrices.
+      *  @param out Destination matrices.
+      *  @param n Number of matrices.
+      *  @param transposeResult If true writes the inverse-transpose (normal matrices) instead.
+    */
+    inline void inverseBatch(const Matriz3x3* in, Matriz3x3* out, size_t n, bool transposeResult = false) {
+      Parallel::parallelFor(0, n, INVERSE_BATCH_PARALLEL_THRESHOLD, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          float det;
+          out[i] = transposeResult ? in[i].inverse(det).transposed() : in[i].inverse(det);
+        }
+      });
+    }
+
   } 
 }
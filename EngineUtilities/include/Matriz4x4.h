@@ -1,7 +1,11 @@
   #pragma once
 
 #include "EngineMath.h"
+#include "EngineParallel.h"
+#include "EngineSIMD.h"
 #include "Vector3.h"
+#include <cstddef>
+#include <type_traits>
 #include <iostream> 
 #include "Matriz3x3.h"
 
@@ -13,18 +17,62 @@ namespace EngineUtilities {
 *  @brief Namespace containing matrix types.
 */
 namespace Matrices {
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+namespace detail {
+/*
+*  @brief Lane permute of one register, result = (v[x], v[y], v[z], v[w]).
+*/
+#define ENGINEUTILITIES_SWIZZLE(v, x, y, z, w) \
+  _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(v), _MM_SHUFFLE(w, z, y, x)))
+/*
+*  @brief Two-register shuffle, result = (a[x], a[y], b[z], b[w]).
+*/
+#define ENGINEUTILITIES_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+
+/*
+*  @brief 2x2 block product A * B, blocks packed as (m00, m01, m10, m11).
+*/
+inline __m128 mat2Mul(__m128 a, __m128 b) {
+  return _mm_add_ps(_mm_mul_ps(a, ENGINEUTILITIES_SWIZZLE(b, 0, 3, 0, 3)),
+                    _mm_mul_ps(ENGINEUTILITIES_SWIZZLE(a, 1, 0, 3, 2), ENGINEUTILITIES_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/*
+*  @brief 2x2 block product adj(A) * B.
+*/
+inline __m128 mat2AdjMul(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(ENGINEUTILITIES_SWIZZLE(a, 3, 3, 0, 0), b),
+                    _mm_mul_ps(ENGINEUTILITIES_SWIZZLE(a, 1, 1, 2, 2), ENGINEUTILITIES_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+/*
+*  @brief 2x2 block product A * adj(B).
+*/
+inline __m128 mat2MulAdj(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(a, ENGINEUTILITIES_SWIZZLE(b, 3, 0, 3, 0)),
+                    _mm_mul_ps(ENGINEUTILITIES_SWIZZLE(a, 1, 0, 3, 2), ENGINEUTILITIES_SWIZZLE(b, 2, 1, 2, 1)));
+}
+}
+#endif
+
 /*
 *  @brief Structure representing a 4x4 matrix.
+*  Templated over the element type: Matriz4x4 (float, SIMD paths) and Matriz4x4d (double).
 */
-struct Matriz4x4 {
+template <typename T>
+struct TMatriz4x4 {
+/*
+*  @brief Element type.
+*/
+  using value_type = T;
 /*
 *  @brief Matrix elements in column-major order.
 */
-    float m[4][4];
+    T m[4][4];
 /*
 * @brief Default constructor. Initializes as identity matrix.
 */
-  inline Matriz4x4() {
+  constexpr TMatriz4x4() : m{} {
     loadIdentity();
         }
 
@@ -47,10 +95,10 @@ struct Matriz4x4 {
 *  @param m32 Element at row 3, column 2.
 *  @param m33 Element at row 3, column 3.
 */
-  inline Matriz4x4(float m00, float m01, float m02, float m03,
-    float m10, float m11, float m12, float m13,
-    float m20, float m21, float m22, float m23,
-    float m30, float m31, float m32, float m33) {
+  constexpr TMatriz4x4(T m00, T m01, T m02, T m03,
+    T m10, T m11, T m12, T m13,
+    T m20, T m21, T m22, T m23,
+    T m30, T m31, T m32, T m33) : m{} {
       m[0][0] = m00; m[0][1] = m10; m[0][2] = m20; m[0][3] = m30;
       m[1][0] = m01; m[1][1] = m11; m[1][2] = m21; m[1][3] = m31;
       m[2][0] = m02; m[2][1] = m12; m[2][2] = m22; m[2][3] = m32;
@@ -60,7 +108,7 @@ struct Matriz4x4 {
 /*
 *  @brief Loads the identity matrix into this matrix.
 */
-   inline void loadIdentity() {
+   constexpr void loadIdentity() {
        m[0][0] = 1.0f; m[0][1] = 0.0f; m[0][2] = 0.0f; m[0][3] = 0.0f;
        m[1][0] = 0.0f; m[1][1] = 1.0f; m[1][2] = 0.0f; m[1][3] = 0.0f;
        m[2][0] = 0.0f; m[2][1] = 0.0f; m[2][2] = 1.0f; m[2][3] = 0.0f;
@@ -71,8 +119,8 @@ struct Matriz4x4 {
         *  @brief Returns an identity matrix.
         *  @return Matriz4x4 identity matrix.
       */
-      static inline Matriz4x4 Identity() {
-        return Matriz4x4();
+      static constexpr TMatriz4x4 Identity() {
+        return TMatriz4x4();
       }
 
       /*
@@ -80,18 +128,46 @@ struct Matriz4x4 {
         *  @param other The matrix to multiply by.
         *  @return The result of the multiplication.
       */
-      inline 
-        Matriz4x4 operator*(const Matriz4x4& other) const {
-        Matriz4x4 result;
-          for (int i = 0; i < 4; ++i) { 
-            for (int j = 0; j < 4; ++j) { 
-              result.m[j][i] = 0.0f;
-              for (int k = 0; k < 4; ++k) {
-                result.m[j][i] += m[k][i] * other.m[j][k];
+      constexpr 
+        TMatriz4x4 operator*(const TMatriz4x4& other) const {
+        TMatriz4x4 result;
+          multiply(*this, other, result);
+          return result;
+      }
+
+      /*
+        *  @brief Computes out = a * b, one output column per step. out may alias a or b.
+        *  @param a Left matrix.
+        *  @param b Right matrix.
+        *  @param out Destination matrix.
+      */
+      static 
+        constexpr void multiply(const TMatriz4x4& a, const TMatriz4x4& b, TMatriz4x4& out) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          if constexpr (std::is_same<T, float>::value) {
+            if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+              SIMD::float4 a0 = SIMD::loadu4(a.m[0]);
+              SIMD::float4 a1 = SIMD::loadu4(a.m[1]);
+              SIMD::float4 a2 = SIMD::loadu4(a.m[2]);
+              SIMD::float4 a3 = SIMD::loadu4(a.m[3]);
+              for (int j = 0; j < 4; ++j) {
+                SIMD::float4 r = SIMD::mul4(a0, SIMD::splat4(b.m[j][0]));
+                r = SIMD::add4(r, SIMD::mul4(a1, SIMD::splat4(b.m[j][1])));
+                r = SIMD::add4(r, SIMD::mul4(a2, SIMD::splat4(b.m[j][2])));
+                r = SIMD::add4(r, SIMD::mul4(a3, SIMD::splat4(b.m[j][3])));
+                SIMD::storeu4(out.m[j], r);
               }
+              return;
+            }
+          }
+#endif
+          TMatriz4x4 lhs = a;
+          for (int j = 0; j < 4; ++j) {
+            T b0 = b.m[j][0], b1 = b.m[j][1], b2 = b.m[j][2], b3 = b.m[j][3];
+            for (int i = 0; i < 4; ++i) {
+              out.m[j][i] = lhs.m[0][i] * b0 + lhs.m[1][i] * b1 + lhs.m[2][i] * b2 + lhs.m[3][i] * b3;
             }
           }
-          return result;
       }
 
       /*
@@ -99,16 +175,16 @@ struct Matriz4x4 {
         *  @param v The vector to transform.
         *  @return The transformed vector.
       */
-      inline Vectors::Vector3 operator*(const Vectors::Vector3& v) const {
-        float x = m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z + m[3][0];
-        float y = m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z + m[3][1];
-        float z = m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z + m[3][2];
-        float w = m[0][3] * v.x + m[1][3] * v.y + m[2][3] * v.z + m[3][3];
+      constexpr Vectors::TVector3<T> operator*(const Vectors::TVector3<T>& v) const {
+        T x = m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z + m[3][0];
+        T y = m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z + m[3][1];
+        T z = m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z + m[3][2];
+        T w = m[0][3] * v.x + m[1][3] * v.y + m[2][3] * v.z + m[3][3];
 
-          if (!Math::approxEqual(w, 1.0f) && !Math::approxEqual(w, 0.0f)) {
-            return Vectors::Vector3(x / w, y / w, z / w);
+          if (!Math::approxEqual(w, T(1)) && !Math::approxEqual(w, T(0))) {
+            return Vectors::TVector3<T>(x / w, y / w, z / w);
           }
-          return Vectors::Vector3(x, y, z);
+          return Vectors::TVector3<T>(x, y, z);
       }
 
       /*
@@ -117,8 +193,8 @@ struct Matriz4x4 {
         *  @return The translation matrix.
       */
       static 
-        inline Matriz4x4 createTranslation(const Vectors::Vector3& t) {
-          Matriz4x4 result;
+        constexpr TMatriz4x4 createTranslation(const Vectors::TVector3<T>& t) {
+          TMatriz4x4 result;
           result.m[3][0] = t.x;
           result.m[3][1] = t.y;
           result.m[3][2] = t.z;
@@ -131,8 +207,8 @@ struct Matriz4x4 {
         *  @return The scale matrix.
       */
       static 
-        inline Matriz4x4 createScale(const Vectors::Vector3& s) {
-          Matriz4x4 result;
+        constexpr TMatriz4x4 createScale(const Vectors::TVector3<T>& s) {
+          TMatriz4x4 result;
           result.m[0][0] = s.x;
           result.m[1][1] = s.y;
           result.m[2][2] = s.z;
@@ -140,24 +216,457 @@ struct Matriz4x4 {
           return result;
       }
 
+      /*
+        *  @brief Right-handed perspective projection (camera looks down -Z), OpenGL clip depth:
+        *  the near plane maps to -1 and the far plane to +1.
+        *  @param fovY Vertical field of view in radians.
+        *  @param aspect Width / height.
+        *  @param zNear Distance to the near plane (> 0).
+        *  @param zFar Distance to the far plane (> zNear).
+        *  @return The projection matrix; invert it with inversePerspective().
+      */
+      static 
+        constexpr TMatriz4x4 createPerspective(T fovY, T aspect, T zNear, T zFar) {
+          T s = 0.0f, c = 0.0f;
+          Math::sincos(fovY * 0.5f, &s, &c);
+          T f = c / s;
+          TMatriz4x4 result;
+          result.m[0][0] = f / aspect;
+          result.m[1][1] = f;
+          result.m[2][2] = (zFar + zNear) / (zNear - zFar);
+          result.m[2][3] = -1.0f;
+          result.m[3][2] = 2.0f * zFar * zNear / (zNear - zFar);
+          result.m[3][3] = 0.0f;
+          return result;
+      }
+
+      /*
+        *  @brief Right-handed perspective projection with reversed Z and no far plane: clip depth
+        *  is zero-to-one with the near plane at 1 and infinity at 0. Spreads float depth precision
+        *  evenly over distance; use with a GREATER depth test and a zero-to-one Frustum.
+        *  @param fovY Vertical field of view in radians.
+        *  @param aspect Width / height.
+        *  @param zNear Distance to the near plane (> 0).
+        *  @return The projection matrix; invert it with inversePerspective().
+      */
+      static 
+        constexpr TMatriz4x4 createPerspectiveInfiniteReversedZ(T fovY, T aspect, T zNear) {
+          T s = 0.0f, c = 0.0f;
+          Math::sincos(fovY * 0.5f, &s, &c);
+          T f = c / s;
+          TMatriz4x4 result;
+          result.m[0][0] = f / aspect;
+          result.m[1][1] = f;
+          result.m[2][2] = 0.0f;
+          result.m[2][3] = -1.0f;
+          result.m[3][2] = zNear;
+          result.m[3][3] = 0.0f;
+          return result;
+      }
+
+      /*
+        *  @brief Right-handed orthographic projection, OpenGL clip depth (-zNear maps to -1, -zFar to +1).
+        *  @return The projection matrix; invert it with inverseOrthographic().
+      */
+      static 
+        constexpr TMatriz4x4 createOrthographic(T left, T right, T bottom, T top, T zNear, T zFar) {
+          TMatriz4x4 result;
+          result.m[0][0] = 2.0f / (right - left);
+          result.m[1][1] = 2.0f / (top - bottom);
+          result.m[2][2] = -2.0f / (zFar - zNear);
+          result.m[3][0] = -(right + left) / (right - left);
+          result.m[3][1] = -(top + bottom) / (top - bottom);
+          result.m[3][2] = -(zFar + zNear) / (zFar - zNear);
+          return result;
+      }
+
+      /*
+        *  @brief Right-handed view matrix looking from eye towards target (the camera looks down -Z).
+        *  @param eye Camera position.
+        *  @param target Point the camera looks at.
+        *  @param up Up direction (must not be parallel to target - eye).
+        *  @return The view matrix. It is rigid, so inverseOrthonormal() gives the camera-to-world matrix.
+      */
+      static 
+        constexpr TMatriz4x4 createLookAt(const Vectors::TVector3<T>& eye, const Vectors::TVector3<T>& target,
+                                          const Vectors::TVector3<T>& up) {
+          Vectors::TVector3<T> f = (target - eye).normalized();
+          Vectors::TVector3<T> s = f.cross(up).normalized();
+          Vectors::TVector3<T> u = s.cross(f);
+          return TMatriz4x4(s.x, s.y, s.z, -s.dot(eye),
+            u.x, u.y, u.z, -u.dot(eye),
+            -f.x, -f.y, -f.z, f.dot(eye),
+            0.0f, 0.0f, 0.0f, 1.0f);
+      }
+
       /*
         *  @brief Extracts the rotation part as a 3x3 matrix.
         *  @return The rotation matrix (3x3).
       */
-      inline EngineUtilities::Matriz::Matriz3x3 getRotationMatriz3x3() const  {
-        return EngineUtilities::Matriz::Matriz3x3::Matriz3x3(m[0][0], m[1][0], m[2][0],
+      constexpr EngineUtilities::Matriz::TMatriz3x3<T> getRotationMatriz3x3() const  {
+        return EngineUtilities::Matriz::TMatriz3x3<T>(m[0][0], m[1][0], m[2][0],
           m[0][1], m[1][1], m[2][1],
           m[0][2], m[1][2], m[2][2]);
       }
+
+      /*
+        *  @brief Returns the transposed matrix.
+        *  @return Transposed matrix.
+      */
+      constexpr TMatriz4x4 transposed() const {
+        TMatriz4x4 result;
+        for (int i = 0; i < 4; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            result.m[j][i] = m[i][j];
+          }
+        }
+        return result;
+      }
+
+      /*
+        *  @brief Calculates the determinant with 2x2 sub-determinant (Laplace) expansion.
+        *  @return Determinant value.
+      */
+      constexpr T determinant() const {
+        T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+        T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      }
+
+      /*
+        *  @brief Product of the lengths of the first count columns, measured over their first
+        *  rows components. Bounds |det| of that block (Hadamard), so singularity tests scaled by
+        *  it do not reject uniformly small matrices such as a centimetre-to-metre scale.
+      */
+      constexpr T columnLengthProduct(int count, int rows) const {
+        T product = 1.0f;
+        for (int c = 0; c < count; ++c) {
+          T sq = 0.0f;
+          for (int r = 0; r < rows; ++r) {
+            sq += m[c][r] * m[c][r];
+          }
+          product *= Math::sqrt(sq);
+        }
+        return product;
+      }
+
+      /*
+        *  @brief Returns the inverse of a general matrix (2x2 block cofactor method, SSE2 when available).
+        *  @return Inverse matrix, or identity if |det| <= EPSILON * columnLengthProduct(4, 4).
+      */
+      constexpr TMatriz4x4 inverse() const {
+        TMatriz4x4 result;
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            __m128 c0 = _mm_loadu_ps(m[0]);
+            __m128 c1 = _mm_loadu_ps(m[1]);
+            __m128 c2 = _mm_loadu_ps(m[2]);
+            __m128 c3 = _mm_loadu_ps(m[3]);
+
+            // 2x2 blocks of the stored array, each packed as (r0c0, r0c1, r1c0, r1c1).
+            __m128 A = _mm_movelh_ps(c0, c1);
+            __m128 B = _mm_movehl_ps(c1, c0);
+            __m128 C = _mm_movelh_ps(c2, c3);
+            __m128 D = _mm_movehl_ps(c3, c2);
+
+            // (|A|, |B|, |C|, |D|)
+            __m128 detSub = _mm_sub_ps(
+              _mm_mul_ps(ENGINEUTILITIES_SHUFFLE(c0, c2, 0, 2, 0, 2), ENGINEUTILITIES_SHUFFLE(c1, c3, 1, 3, 1, 3)),
+              _mm_mul_ps(ENGINEUTILITIES_SHUFFLE(c0, c2, 1, 3, 1, 3), ENGINEUTILITIES_SHUFFLE(c1, c3, 0, 2, 0, 2)));
+            __m128 detA = ENGINEUTILITIES_SWIZZLE(detSub, 0, 0, 0, 0);
+            __m128 detB = ENGINEUTILITIES_SWIZZLE(detSub, 1, 1, 1, 1);
+            __m128 detC = ENGINEUTILITIES_SWIZZLE(detSub, 2, 2, 2, 2);
+            __m128 detD = ENGINEUTILITIES_SWIZZLE(detSub, 3, 3, 3, 3);
+
+            __m128 D_C = detail::mat2AdjMul(D, C);
+            __m128 A_B = detail::mat2AdjMul(A, B);
+            __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), detail::mat2Mul(B, D_C));
+            __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), detail::mat2Mul(C, A_B));
+            __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), detail::mat2MulAdj(D, A_B));
+            __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), detail::mat2MulAdj(A, D_C));
+
+            // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+            __m128 tr = _mm_mul_ps(A_B, ENGINEUTILITIES_SWIZZLE(D_C, 0, 2, 1, 3));
+            tr = _mm_add_ps(tr, ENGINEUTILITIES_SWIZZLE(tr, 2, 3, 0, 1));
+            tr = _mm_add_ps(tr, ENGINEUTILITIES_SWIZZLE(tr, 1, 0, 3, 2));
+            __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+            T det = _mm_cvtss_f32(detM);
+            if (!(Math::abs(det) > Math::Constants<T>::EPSILON * columnLengthProduct(4, 4))) {
+              return Identity();
+            }
+            __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+            X_ = _mm_mul_ps(X_, rDetM);
+            Y_ = _mm_mul_ps(Y_, rDetM);
+            Z_ = _mm_mul_ps(Z_, rDetM);
+            W_ = _mm_mul_ps(W_, rDetM);
+
+            _mm_storeu_ps(result.m[0], ENGINEUTILITIES_SHUFFLE(X_, Y_, 3, 1, 3, 1));
+            _mm_storeu_ps(result.m[1], ENGINEUTILITIES_SHUFFLE(X_, Y_, 2, 0, 2, 0));
+            _mm_storeu_ps(result.m[2], ENGINEUTILITIES_SHUFFLE(Z_, W_, 3, 1, 3, 1));
+            _mm_storeu_ps(result.m[3], ENGINEUTILITIES_SHUFFLE(Z_, W_, 2, 0, 2, 0));
+            return result;
+          }
+        }
+#endif
+        T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+        T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (!(Math::abs(det) > Math::Constants<T>::EPSILON * columnLengthProduct(4, 4))) {
+          return Identity();
+        }
+        T invDet = 1.0f / det;
+
+        result.m[0][0] = ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * invDet;
+        result.m[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * invDet;
+        result.m[0][2] = ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * invDet;
+        result.m[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * invDet;
+
+        result.m[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * invDet;
+        result.m[1][1] = ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * invDet;
+        result.m[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * invDet;
+        result.m[1][3] = ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * invDet;
+
+        result.m[2][0] = ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * invDet;
+        result.m[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * invDet;
+        result.m[2][2] = ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * invDet;
+        result.m[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * invDet;
+
+        result.m[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * invDet;
+        result.m[3][1] = ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * invDet;
+        result.m[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * invDet;
+        result.m[3][3] = ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * invDet;
+        return result;
+      }
+
+      /*
+        *  @brief Inverse of an affine transform (last row 0, 0, 0, 1), e.g. rotation, scale and
+        *  translation. Inverts the 3x3 part through cross products of its columns.
+        *  @return Inverse matrix, or identity if the 3x3 part is singular
+        *  (|det| <= EPSILON * columnLengthProduct(3, 3)).
+      */
+      constexpr TMatriz4x4 inverseAffine() const {
+        Vectors::TVector3<T> c0(m[0][0], m[0][1], m[0][2]);
+        Vectors::TVector3<T> c1(m[1][0], m[1][1], m[1][2]);
+        Vectors::TVector3<T> c2(m[2][0], m[2][1], m[2][2]);
+        Vectors::TVector3<T> t(m[3][0], m[3][1], m[3][2]);
+
+        Vectors::TVector3<T> r0 = c1.cross(c2);
+        T det = c0.dot(r0);
+        if (!(Math::abs(det) > Math::Constants<T>::EPSILON * columnLengthProduct(3, 3))) {
+          return Identity();
+        }
+        T invDet = 1.0f / det;
+        r0 *= invDet;
+        Vectors::TVector3<T> r1 = c2.cross(c0) * invDet;
+        Vectors::TVector3<T> r2 = c0.cross(c1) * invDet;
+
+        return TMatriz4x4(r0.x, r0.y, r0.z, -r0.dot(t),
+          r1.x, r1.y, r1.z, -r1.dot(t),
+          r2.x, r2.y, r2.z, -r2.dot(t),
+          0.0f, 0.0f, 0.0f, 1.0f);
+      }
+
+      /*
+        *  @brief Inverse of a rigid transform (orthonormal rotation + translation): R^T and -R^T t.
+        *  @return Inverse matrix. The result is wrong if the 3x3 part has scale or shear.
+      */
+      constexpr TMatriz4x4 inverseOrthonormal() const {
+        T tx = m[3][0], ty = m[3][1], tz = m[3][2];
+        return TMatriz4x4(m[0][0], m[0][1], m[0][2], -(m[0][0] * tx + m[0][1] * ty + m[0][2] * tz),
+          m[1][0], m[1][1], m[1][2], -(m[1][0] * tx + m[1][1] * ty + m[1][2] * tz),
+          m[2][0], m[2][1], m[2][2], -(m[2][0] * tx + m[2][1] * ty + m[2][2] * tz),
+          0.0f, 0.0f, 0.0f, 1.0f);
+      }
+
+      /*
+        *  @brief Closed-form inverse of a perspective projection (createPerspective or
+        *  createPerspectiveInfiniteReversedZ): only m00, m11, m22, m23 and m32 are non-zero.
+        *  @return Inverse matrix (clip space back to view space). The result is wrong for other matrices.
+      */
+      constexpr TMatriz4x4 inversePerspective() const {
+        T a = m[0][0], b = m[1][1], c = m[2][2], d = m[3][2], e = m[2][3];
+        return TMatriz4x4(1.0f / a, 0.0f, 0.0f, 0.0f,
+          0.0f, 1.0f / b, 0.0f, 0.0f,
+          0.0f, 0.0f, 0.0f, 1.0f / e,
+          0.0f, 0.0f, 1.0f / d, -c / (d * e));
+      }
+
+      /*
+        *  @brief Closed-form inverse of an orthographic projection (diagonal scale + translation).
+        *  @return Inverse matrix. The result is wrong for other matrices.
+      */
+      constexpr TMatriz4x4 inverseOrthographic() const {
+        T sx = 1.0f / m[0][0], sy = 1.0f / m[1][1], sz = 1.0f / m[2][2];
+        return TMatriz4x4(sx, 0.0f, 0.0f, -m[3][0] * sx,
+          0.0f, sy, 0.0f, -m[3][1] * sy,
+          0.0f, 0.0f, sz, -m[3][2] * sz,
+          0.0f, 0.0f, 0.0f, 1.0f);
+      }
     };
 
+    using Matriz4x4 = TMatriz4x4<float>;
+    using Matriz4x4d = TMatriz4x4<double>;
+
+    static_assert(std::is_trivially_copyable<Matriz4x4>::value, "Matriz4x4 must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Matriz4x4d>::value, "Matriz4x4d must be trivially copyable");
+    static_assert(std::is_standard_layout<Matriz4x4>::value, "Matriz4x4 must be standard layout");
+    static_assert(std::is_standard_layout<Matriz4x4d>::value, "Matriz4x4d must be standard layout");
+    static_assert(sizeof(Matriz4x4) == 16 * sizeof(float), "Matriz4x4 must stay sixteen packed floats");
+    static_assert(sizeof(Matriz4x4d) == 16 * sizeof(double), "Matriz4x4d must stay sixteen packed doubles");
+    static_assert(alignof(Matriz4x4) == alignof(float), "Matriz4x4 must keep float alignment");
+
+    namespace detail {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+      /*
+        *  @brief AVX2 batch multiply: two output columns per 256-bit register.
+      */
+      ENGINEUTILITIES_TARGET_AVX2 inline 
+        void multiplyBatchAVX2(const Matriz4x4* a, const Matriz4x4* b, Matriz4x4* out, size_t n) {
+          for (size_t i = 0; i < n; ++i) {
+            __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a[i].m[0]));
+            __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a[i].m[1]));
+            __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a[i].m[2]));
+            __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a[i].m[3]));
+            __m256 b01 = _mm256_loadu_ps(b[i].m[0]);
+            __m256 b23 = _mm256_loadu_ps(b[i].m[2]);
+
+            __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+            r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+            r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xAA), r01);
+            r01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xFF), r01);
+            __m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+            r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+            r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xAA), r23);
+            r23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xFF), r23);
+
+            _mm256_storeu_ps(out[i].m[0], r01);
+            _mm256_storeu_ps(out[i].m[2], r23);
+          }
+      }
+#endif
+
+      /*
+        *  @brief Serial batch multiply over one contiguous range.
+      */
+      inline 
+        void multiplyBatchRange(const Matriz4x4* a, const Matriz4x4* b, Matriz4x4* out, size_t n) {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+          if (SIMD::hasAVX2()) {
+            multiplyBatchAVX2(a, b, out, n);
+            return;
+          }
+#endif
+          for (size_t i = 0; i < n; ++i) {
+            Matriz4x4::multiply(a[i], b[i], out[i]);
+          }
+      }
+
+      /*
+        *  @brief Serial point transform over one contiguous range.
+      */
+      inline 
+        void transformPointsRange(const Matriz4x4& mat, bool affine, const Vectors::Vector3* in,
+                                  Vectors::Vector3* out, size_t n) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          SIMD::float4 c0 = SIMD::loadu4(mat.m[0]);
+          SIMD::float4 c1 = SIMD::loadu4(mat.m[1]);
+          SIMD::float4 c2 = SIMD::loadu4(mat.m[2]);
+          SIMD::float4 c3 = SIMD::loadu4(mat.m[3]);
+          float r[4];
+          for (size_t i = 0; i < n; ++i) {
+            SIMD::float4 v = SIMD::add4(SIMD::mul4(c0, SIMD::splat4(in[i].x)), c3);
+            v = SIMD::add4(v, SIMD::mul4(c1, SIMD::splat4(in[i].y)));
+            v = SIMD::add4(v, SIMD::mul4(c2, SIMD::splat4(in[i].z)));
+            SIMD::storeu4(r, v);
+            if (!affine && !Math::approxEqual(r[3], 1.0f) && !Math::approxEqual(r[3], 0.0f)) {
+              float invW = 1.0f / r[3];
+              r[0] *= invW;
+              r[1] *= invW;
+              r[2] *= invW;
+            }
+            out[i].x = r[0];
+            out[i].y = r[1];
+            out[i].z = r[2];
+          }
+#else
+          for (size_t i = 0; i < n; ++i) {
+            out[i] = affine ? Vectors::Vector3(
+              mat.m[0][0] * in[i].x + mat.m[1][0] * in[i].y + mat.m[2][0] * in[i].z + mat.m[3][0],
+              mat.m[0][1] * in[i].x + mat.m[1][1] * in[i].y + mat.m[2][1] * in[i].z + mat.m[3][1],
+              mat.m[0][2] * in[i].x + mat.m[1][2] * in[i].y + mat.m[2][2] * in[i].z + mat.m[3][2])
+              : mat * in[i];
+          }
+#endif
+      }
+    }
+
+    /*
+      *  @brief Batch size below which the batch kernels stay on the calling thread.
+    */
+    const 
+      size_t BATCH_PARALLEL_THRESHOLD = 4096;
+
+    /*
+      *  @brief Computes out[i] = a[i] * b[i] for n matrix pairs (SIMD, split across threads for large n).
+      *  out may alias a or b element-wise.
+      *  @param a Left matrices.
+      *  @param b Right matrices.
+      *  @param out Destination matrices.
+      *  @param n Number of matrices.
+    */
+    inline 
+      void multiplyBatch(const Matriz4x4* a, const Matriz4x4* b, Matriz4x4* out, size_t n) {
+        Parallel::parallelFor(0, n, BATCH_PARALLEL_THRESHOLD, [=](size_t begin, size_t end) {
+          detail::multiplyBatchRange(a + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+    /*
+      *  @brief Transforms n points by mat, with the same perspective divide rules as
+      *  Matriz4x4::operator*(Vector3). Affine matrices (last row 0,0,0,1) skip the w test entirely.
+      *  @param mat Transform matrix.
+      *  @param in Input points.
+      *  @param out Output points. May alias in.
+      *  @param n Number of points.
+    */
+    inline 
+      void transformPoints(const Matriz4x4& mat, const Vectors::Vector3* in, Vectors::Vector3* out, size_t n) {
+        bool affine = mat.m[0][3] == 0.0f && mat.m[1][3] == 0.0f && mat.m[2][3] == 0.0f && mat.m[3][3] == 1.0f;
+        Parallel::parallelFor(0, n, BATCH_PARALLEL_THRESHOLD, [&mat, affine, in, out](size_t begin, size_t end) {
+          detail::transformPointsRange(mat, affine, in + begin, out + begin, end - begin);
+        });
+    }
+
     /*
       *  @brief Outputs the matrix to a stream in a readable format.
       *  @param os Output stream.
       *  @param mat Matrix to output.
       *  @return Output stream.
     */
-    inline std::ostream& operator<<(std::ostream& os, const Matriz4x4& mat) {
+    template <typename T>
+    inline std::ostream& operator<<(std::ostream& os, const TMatriz4x4<T>& mat) {
       os << "Matriz4x4:\n";
       for (int i = 0; i < 4; ++i) { 
         os << "| ";
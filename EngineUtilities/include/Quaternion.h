@@ -2,26 +2,40 @@
     #pragma once
 
     #include "EngineMath.h"
+    #include "EngineSIMD.h"
+    #include "EngineHalf.h"
     #include "Vector3.h"
     #include "Matriz4x4.h" /
+    #include <cstddef>
     #include <iostream>
+    #include <type_traits>
 
     namespace EngineUtilities {
       namespace Rotations {
 
         /*
           *  @brief Structure representing a quaternion for 3D rotations.
+          *  Products and normalization map onto one 128-bit register (SSE2 / NEON) when available;
+          *  define ENGINEUTILITIES_ALIGNED_VEC4 to also make the storage 16-byte aligned.
+          *  Templated over the component type; the register paths only apply to Quaternion (float).
+          *  Quaterniond and Quaternionh (half storage) use the scalar code.
         */
-        struct Quaternion {
+        template <typename T>
+        struct ENGINEUTILITIES_ALIGN_VEC4(T) TQuaternion {
+          /*
+            *  @brief Scalar type of the components.
+          */
+          using value_type = T;
+
           /*
             *  @brief X component of the quaternion.
           */
-          float x, y, z, w;
+          T x, y, z, w;
 
           /*
             *  @brief Default constructor. Initializes as identity quaternion.
           */
-          inline Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+          constexpr TQuaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
           /*
             *  @brief Constructor with explicit values for each component.
             *  @param inX X component.
@@ -29,42 +43,50 @@
             *  @param inZ Z component.
             *  @param inW W component.
           */
-          inline Quaternion(float inX, float inY, float inZ, float inW) : x(inX), y(inY), z(inZ), w(inW) {}
+          constexpr TQuaternion(T inX, T inY, T inZ, T inW) : x(inX), y(inY), z(inZ), w(inW) {}
+
+    #if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          /*
+            *  @brief Loads the four components into a SIMD register.
+            *  @return Register holding (x, y, z, w).
+          */
+          inline SIMD::float4 load() const {
+            return SIMD::load4(&x);
+          }
+
+          /*
+            *  @brief Builds a quaternion from a SIMD register.
+            *  @param v Register holding (x, y, z, w).
+            *  @return Resulting quaternion.
+          */
+          static inline TQuaternion fromSIMD(SIMD::float4 v) {
+            TQuaternion q;
+            SIMD::store4(&q.x, v);
+            return q;
+          }
+    #endif
 
           /*
             *  @brief Constructs a quaternion from an axis and angle in radians.
             *  @param axis Rotation axis.
             *  @param angle_rad Rotation angle in radians.
           */
-          inline Quaternion(const Vectors::Vector3& axis, float angle_rad) {
-            float half_angle = angle_rad * 0.5f;
-            float sin_half_angle = Math::sin(half_angle);
-            w = Math::cos(half_angle);
+          constexpr TQuaternion(const Vectors::TVector3<T>& axis, T angle_rad) : TQuaternion() {
+            T half_angle = angle_rad * 0.5f;
+            T sin_half_angle = 0.0f;
+            Math::sincos(half_angle, &sin_half_angle, &w);
             x = axis.x * sin_half_angle;
             y = axis.y * sin_half_angle;
             z = axis.z * sin_half_angle;
             normalize();
           }
 
-          /*
-            *  @brief Assignment operator.
-            *  @param other Quaternion to assign from.
-            *  @return Reference to this quaternion.
-          */
-          inline Quaternion& operator=(const Quaternion& other) {
-            x = other.x;
-            y = other.y;
-            z = other.z;
-            w = other.w;
-            return *this;
-          }
-
           /*
             *  @brief Equality operator.
             *  @param other Quaternion to compare.
             *  @return True if equal, false otherwise.
           */
-          inline bool operator==(const Quaternion& other) const {
+          constexpr bool operator==(const TQuaternion& other) const {
             return Math::approxEqual(x, other.x) &&
               Math::approxEqual(y, other.y) &&
               Math::approxEqual(z, other.z) &&
@@ -76,7 +98,7 @@
             *  @param other Quaternion to compare.
             *  @return True if not equal, false otherwise.
           */
-          inline bool operator!=(const Quaternion& other) const {
+          constexpr bool operator!=(const TQuaternion& other) const {
             return !(*this == other);
           }
 
@@ -85,8 +107,23 @@
             *  @param other Quaternion to multiply by.
             *  @return Resulting quaternion.
           */
-          inline Quaternion operator*(const Quaternion& other) const {
-            return Quaternion(
+          constexpr TQuaternion operator*(const TQuaternion& other) const {
+    #if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+            if constexpr (std::is_same<T, float>::value) {
+              if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+                SIMD::float4 b = other.load();
+                SIMD::float4 r = SIMD::mul4(SIMD::splat4(w), b);
+                r = SIMD::add4(r, SIMD::mul4(SIMD::mul4(SIMD::splat4(x), SIMD::swizzleWZYX(b)),
+                                             SIMD::set4(1.0f, -1.0f, 1.0f, -1.0f)));
+                r = SIMD::add4(r, SIMD::mul4(SIMD::mul4(SIMD::splat4(y), SIMD::swizzleZWXY(b)),
+                                             SIMD::set4(1.0f, 1.0f, -1.0f, -1.0f)));
+                r = SIMD::add4(r, SIMD::mul4(SIMD::mul4(SIMD::splat4(z), SIMD::swizzleYXWZ(b)),
+                                             SIMD::set4(-1.0f, 1.0f, 1.0f, -1.0f)));
+                return fromSIMD(r);
+              }
+            }
+    #endif
+            return TQuaternion(
               w * other.x + x * other.w + y * other.z - z * other.y,
               w * other.y - x * other.z + y * other.w + z * other.x,
               w * other.z + x * other.y - y * other.x + z * other.w,
@@ -99,57 +136,76 @@
             *  @param scalar Scalar value.
             *  @return Resulting quaternion.
           */
-          inline Quaternion operator*(float scalar) const {
-            return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+          constexpr TQuaternion operator*(T scalar) const {
+    #if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+            if constexpr (std::is_same<T, float>::value) {
+              if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+                return fromSIMD(SIMD::mul4(load(), SIMD::splat4(scalar)));
+              }
+            }
+    #endif
+            return TQuaternion(x * scalar, y * scalar, z * scalar, w * scalar);
           }
 
           /*
-            *  @brief Rotates a vector by this quaternion.
+            *  @brief Rotates a vector by this (unit) quaternion.
+            *  Expands q * v * conjugate(q) to t = 2 (q.xyz x v), v' = v + w t + q.xyz x t,
+            *  two cross products instead of two full quaternion products.
             *  @param vec Vector to rotate.
             *  @return Rotated vector.
           */
-          inline Vectors::Vector3 operator*(const Vectors::Vector3& vec) const {
-            Quaternion p(vec.x, vec.y, vec.z, 0.0f);
-
-            Quaternion q_inv;
-            q_inv.x = -x;
-            q_inv.y = -y;
-            q_inv.z = -z;
-            q_inv.w = w;
-
-            Quaternion temp = (*this) * p;
-            Quaternion rotated_p = temp * q_inv;
-
-            return Vectors::Vector3(rotated_p.x, rotated_p.y, rotated_p.z);
+          constexpr Vectors::TVector3<T> operator*(const Vectors::TVector3<T>& vec) const {
+            T tx = 2.0f * (y * vec.z - z * vec.y);
+            T ty = 2.0f * (z * vec.x - x * vec.z);
+            T tz = 2.0f * (x * vec.y - y * vec.x);
+
+            return Vectors::TVector3<T>(
+              vec.x + w * tx + (y * tz - z * ty),
+              vec.y + w * ty + (z * tx - x * tz),
+              vec.z + w * tz + (x * ty - y * tx)
+            );
           }
 
           /*
             *  @brief Returns the magnitude of the quaternion.
-            *  @return Magnitude as float.
+            *  @return Magnitude as T.
+          */
+          constexpr T magnitude() const {
+            return Math::sqrt(squareMagnitude());
+          }
+
+          /*
+            *  @brief Four-component dot product with another quaternion.
+            *  @param other Quaternion to dot with.
+            *  @return Dot product value.
           */
-          inline float magnitude() const {
-            return Math::sqrt(x * x + y * y + z * z + w * w);
+          constexpr T dot(const TQuaternion& other) const {
+    #if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+            if constexpr (std::is_same<T, float>::value) {
+              if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+                return SIMD::dot4(load(), other.load());
+              }
+            }
+    #endif
+            return x * other.x + y * other.y + z * other.z + w * other.w;
           }
 
           /*
             *  @brief Returns the squared magnitude of the quaternion.
-            *  @return Squared magnitude as float.
+            *  @return Squared magnitude as T.
           */
-          inline float squareMagnitude() const {
-            return x * x + y * y + z * z + w * w;
+          constexpr T squareMagnitude() const {
+            return dot(*this);
           }
 
           /*
             *  @brief Normalizes the quaternion in place.
             *  @return Reference to this quaternion.
           */
-          inline Quaternion& normalize() {
-            float mag = magnitude();
-            if (mag > Math::EPSILON) {
-              x /= mag;
-              y /= mag;
-              z /= mag;
-              w /= mag;
+          constexpr TQuaternion& normalize() {
+            T sqMag = squareMagnitude();
+            if (sqMag > Math::Constants<T>::EPSILON * Math::Constants<T>::EPSILON) {
+              *this = *this * Math::rsqrt(sqMag);
             }
             return *this;
           }
@@ -158,8 +214,8 @@
             *  @brief Returns a normalized copy of the quaternion.
             *  @return Normalized quaternion.
           */
-          inline Quaternion normalized() const {
-            Quaternion q = *this;
+          constexpr TQuaternion normalized() const {
+            TQuaternion q = *this;
             q.normalize();
             return q;
           }
@@ -168,18 +224,18 @@
             *  @brief Returns the conjugate of the quaternion.
             *  @return Conjugated quaternion.
           */
-          inline Quaternion conjugate() const {
-            return Quaternion(-x, -y, -z, w);
+          constexpr TQuaternion conjugate() const {
+            return TQuaternion(-x, -y, -z, w);
           }
 
           /*
             *  @brief Returns the inverse of the quaternion.
             *  @return Inverted quaternion.
           */
-          inline Quaternion inverse() const { 
-            float sqMag = squareMagnitude(); 
-            if (Math::abs(sqMag) < Math::EPSILON) { 
-              return Quaternion(0.0f, 0.0f, 0.0f, 0.0f); 
+          constexpr TQuaternion inverse() const { 
+            T sqMag = squareMagnitude(); 
+            if (Math::abs(sqMag) < Math::Constants<T>::EPSILON) { 
+              return TQuaternion(0.0f, 0.0f, 0.0f, 0.0f); 
             } 
             return conjugate() * (1.0f / sqMag); 
           } 
@@ -191,10 +247,10 @@
             *  @param t Interpolation factor [0,1].
             *  @return Interpolated quaternion.
           */
-          static inline Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t) {
-            float cos_theta = q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+          static constexpr TQuaternion Slerp(const TQuaternion& q1, const TQuaternion& q2, T t) {
+            T cos_theta = q1.dot(q2);
 
-            Quaternion target_q = q2;
+            TQuaternion target_q = q2;
             if (cos_theta < 0.0f) {
               target_q.x = -q2.x;
               target_q.y = -q2.y;
@@ -203,15 +259,15 @@
               cos_theta = -cos_theta;
             }
 
-            if (cos_theta > 1.0f - Math::EPSILON) {
+            if (cos_theta > 1.0f - Math::Constants<T>::EPSILON) {
               return q1;
             }
 
-            float angle = Math::acos(cos_theta);
-            float sin_angle = Math::sin(angle);
+            T angle = Math::acos(cos_theta);
+            T sin_angle = Math::sin(angle);
 
-            if (Math::abs(sin_angle) < Math::EPSILON) {
-              return Quaternion(
+            if (Math::abs(sin_angle) < Math::Constants<T>::EPSILON) {
+              return TQuaternion(
                 (1.0f - t) * q1.x + t * target_q.x,
                 (1.0f - t) * q1.y + t * target_q.y,
                 (1.0f - t) * q1.z + t * target_q.z,
@@ -219,10 +275,10 @@
               ).normalize();
             }
 
-            float ratio1 = Math::sin((1.0f - t) * angle) / sin_angle;
-            float ratio2 = Math::sin(t * angle) / sin_angle;
+            T ratio1 = Math::sin((1.0f - t) * angle) / sin_angle;
+            T ratio2 = Math::sin(t * angle) / sin_angle;
 
-            return Quaternion(
+            return TQuaternion(
               ratio1 * q1.x + ratio2 * target_q.x,
               ratio1 * q1.y + ratio2 * target_q.y,
               ratio1 * q1.z + ratio2 * target_q.z,
@@ -234,26 +290,26 @@
             *  @brief Returns the identity quaternion.
             *  @return Identity quaternion.
           */
-          static inline Quaternion Identity() {
-            return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+          static constexpr TQuaternion Identity() {
+            return TQuaternion(0.0f, 0.0f, 0.0f, 1.0f);
           }
 
           /*
             *  @brief Converts the quaternion to a 4x4 rotation matrix.
             *  @return Rotation matrix as Matriz4x4.
           */
-          inline Matrices::Matriz4x4 toMatrix4x4() const {
-            Matrices::Matriz4x4 mat;
-
-            float x2 = x * x;
-            float y2 = y * y;
-            float z2 = z * z;
-            float xy = x * y;
-            float xz = x * z;
-            float yz = y * z;
-            float wx = w * x;
-            float wy = w * y;
-            float wz = w * z;
+          constexpr Matrices::TMatriz4x4<T> toMatrix4x4() const {
+            Matrices::TMatriz4x4<T> mat;
+
+            T x2 = x * x;
+            T y2 = y * y;
+            T z2 = z * z;
+            T xy = x * y;
+            T xz = x * z;
+            T yz = y * z;
+            T wx = w * x;
+            T wy = w * y;
+            T wz = w * z;
 
             mat.m[0][0] = 1.0f - 2.0f * (y2 + z2);
             mat.m[0][1] = 2.0f * (xy + wz);
@@ -283,17 +339,17 @@
             *  @param mat Rotation matrix.
             *  @return Quaternion representing the rotation.
           */
-          static inline Quaternion fromMatrix4x4(const Matrices::Matriz4x4& mat) {
-            float m00 = mat.m[0][0]; float m11 = mat.m[1][1]; float m22 = mat.m[2][2];
-            float m01 = mat.m[1][0]; float m10 = mat.m[0][1];
-            float m02 = mat.m[2][0]; float m20 = mat.m[0][2];
-            float m12 = mat.m[2][1]; float m21 = mat.m[1][2];
+          static constexpr TQuaternion fromMatrix4x4(const Matrices::TMatriz4x4<T>& mat) {
+            T m00 = mat.m[0][0]; T m11 = mat.m[1][1]; T m22 = mat.m[2][2];
+            T m01 = mat.m[1][0]; T m10 = mat.m[0][1];
+            T m02 = mat.m[2][0]; T m20 = mat.m[0][2];
+            T m12 = mat.m[2][1]; T m21 = mat.m[1][2];
 
-            float trace = m00 + m11 + m22;
-            Quaternion q;
+            T trace = m00 + m11 + m22;
+            TQuaternion q;
 
-            if (trace > Math::EPSILON) {
-              float s = 0.5f / Math::sqrt(trace + 1.0f);
+            if (trace > Math::Constants<T>::EPSILON) {
+              T s = 0.5f * Math::rsqrt(trace + 1.0f);
               q.w = 0.25f / s;
               q.x = (m21 - m12) * s;
               q.y = (m02 - m20) * s;
@@ -301,21 +357,21 @@
             }
             else {
               if (m00 > m11 && m00 > m22) {
-                float s = 2.0f * Math::sqrt(1.0f + m00 - m11 - m22);
+                T s = 2.0f * Math::sqrt(1.0f + m00 - m11 - m22);
                 q.x = 0.25f * s;
                 q.y = (m01 + m10) / s;
                 q.z = (m02 + m20) / s;
                 q.w = (m21 - m12) / s;
               }
               else if (m11 > m22) {
-                float s = 2.0f * Math::sqrt(1.0f + m11 - m00 - m22);
+                T s = 2.0f * Math::sqrt(1.0f + m11 - m00 - m22);
                 q.x = (m01 + m10) / s;
                 q.y = 0.25f * s;
                 q.z = (m12 + m21) / s;
                 q.w = (m02 - m20) / s;
               }
               else {
-                float s = 2.0f * Math::sqrt(1.0f + m22 - m00 - m11);
+                T s = 2.0f * Math::sqrt(1.0f + m22 - m00 - m11);
                 q.x = (m02 + m20) / s;
                 q.y = (m12 + m21) / s;
                 q.z = 0.25f * s;
@@ -330,25 +386,25 @@
             *  @param axis Output axis vector.
             *  @param angle_rad Output angle in radians.
           */
-          inline void toAxisAngle(Vectors::Vector3& axis, float& angle_rad) const {
-            Quaternion q_normalized = this->normalized();
+          constexpr void toAxisAngle(Vectors::TVector3<T>& axis, T& angle_rad) const {
+            TQuaternion q_normalized = this->normalized();
 
-            if (q_normalized.w > 1.0f - Math::EPSILON) {
-              axis = Vectors::Vector3::UnitX();
+            if (q_normalized.w > 1.0f - Math::Constants<T>::EPSILON) {
+              axis = Vectors::TVector3<T>::UnitX();
               angle_rad = 0.0f;
               return;
             }
-            if (q_normalized.w < -1.0f + Math::EPSILON) {
-              axis = Vectors::Vector3::UnitX();
-              angle_rad = Math::PI;
+            if (q_normalized.w < -1.0f + Math::Constants<T>::EPSILON) {
+              axis = Vectors::TVector3<T>::UnitX();
+              angle_rad = Math::Constants<T>::PI;
               return;
             }
 
             angle_rad = 2.0f * Math::acos(q_normalized.w);
-            float inv_sin_half_angle = 1.0f / Math::sqrt(1.0f - q_normalized.w * q_normalized.w);
+            T inv_sin_half_angle = Math::rsqrt(1.0f - q_normalized.w * q_normalized.w);
 
-            if (Math::abs(inv_sin_half_angle) < Math::EPSILON) {
-              axis = Vectors::Vector3::UnitX();
+            if (Math::abs(inv_sin_half_angle) < Math::Constants<T>::EPSILON) {
+              axis = Vectors::TVector3<T>::UnitX();
               return;
             }
 
@@ -359,13 +415,34 @@
           }
         };
 
+        using Quaternion = TQuaternion<float>;
+        using Quaterniond = TQuaternion<double>;
+        using Quaternionh = TQuaternion<Math::half>;
+
+        static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must stay four packed floats");
+        static_assert(sizeof(Quaterniond) == 4 * sizeof(double), "Quaterniond must stay four packed doubles");
+        static_assert(sizeof(Quaternionh) == 4 * sizeof(Math::half), "Quaternionh must stay four packed halves");
+        static_assert(std::is_trivially_copyable<Quaternion>::value, "Quaternion must be trivially copyable");
+        static_assert(std::is_trivially_copyable<Quaterniond>::value, "Quaterniond must be trivially copyable");
+        static_assert(std::is_trivially_copyable<Quaternionh>::value, "Quaternionh must be trivially copyable");
+        static_assert(std::is_standard_layout<Quaternion>::value, "Quaternion must be standard layout");
+        static_assert(std::is_standard_layout<Quaterniond>::value, "Quaterniond must be standard layout");
+        static_assert(std::is_standard_layout<Quaternionh>::value, "Quaternionh must be standard layout");
+        static_assert(offsetof(Quaternion, w) == 3 * sizeof(float), "Quaternion components must be laid out as x, y, z, w");
+    #if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+        static_assert(alignof(Quaternion) == 16, "Quaternion must be 16-byte aligned in ENGINEUTILITIES_ALIGNED_VEC4 mode");
+    #else
+        static_assert(alignof(Quaternion) == alignof(float), "Quaternion must keep float alignment");
+    #endif
+
         /*
           *  @brief Scalar multiplication operator for quaternion.
           *  @param scalar Scalar value.
           *  @param q Quaternion to multiply.
           *  @return Resulting quaternion.
         */
-        inline Quaternion operator*(float scalar, const Quaternion& q) {
+        template <typename T>
+        constexpr TQuaternion<T> operator*(typename TQuaternion<T>::value_type scalar, const TQuaternion<T>& q) {
           return q * scalar;
         }
 
@@ -375,7 +452,8 @@
           *  @param q Quaternion to output.
           *  @return Output stream.
         */
-        inline std::ostream& operator<<(std::ostream& os, const Quaternion& q) {
+        template <typename T>
+        inline std::ostream& operator<<(std::ostream& os, const TQuaternion<T>& q) {
           os << "Quaternion(x:" << q.x << ", y:" << q.y << ", z:" << q.z << ", w:" << q.w << ")";
           return os;
         }
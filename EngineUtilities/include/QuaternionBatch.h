@@ -0,0 +1,135 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineSIMD.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+#include <cstddef>
+
+namespace EngineUtilities {
+  namespace Rotations {
+
+    namespace detail {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      /*
+        *  @brief Loads q[0..3] transposed to SoA: x, y, z, w hold one component of each quaternion.
+      */
+      inline void loadQuaternions4(const Quaternion* q, SIMD::float4& x, SIMD::float4& y, SIMD::float4& z,
+                                   SIMD::float4& w) {
+        x = SIMD::loadu4(&q[0].x);
+        y = SIMD::loadu4(&q[1].x);
+        z = SIMD::loadu4(&q[2].x);
+        w = SIMD::loadu4(&q[3].x);
+        SIMD::transpose4(x, y, z, w);
+      }
+
+      inline void storeQuaternions4(Quaternion* q, SIMD::float4 x, SIMD::float4 y, SIMD::float4 z, SIMD::float4 w) {
+        SIMD::transpose4(x, y, z, w);
+        SIMD::storeu4(&q[0].x, x);
+        SIMD::storeu4(&q[1].x, y);
+        SIMD::storeu4(&q[2].x, z);
+        SIMD::storeu4(&q[3].x, w);
+      }
+#endif
+
+      /*
+        *  @brief End of the range of 4-element SIMD blocks over n elements. Blocks of Vector3 read
+        *  and write 4 floats per element, touching the next element's x, so they stop one early.
+      */
+      constexpr size_t simdEnd(size_t n, size_t overread) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        return n > overread ? ((n - overread) & ~size_t(3)) : 0;
+#else
+        (void)n;
+        (void)overread;
+        return 0;
+#endif
+      }
+    }
+
+    /*
+      *  @brief Writes out[i] = q[i] * v[i] (q[i] unit), four rotations per SIMD step in SoA form.
+      *  out may be v; otherwise the arrays must not overlap.
+    */
+    inline void rotateBatch(const Quaternion* q, const Vectors::Vector3* v, Vectors::Vector3* out, size_t n) {
+      size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      using namespace SIMD;
+      const float4 two = splat4(2.0f);
+      for (const size_t end = detail::simdEnd(n, 1); i < end; i += 4) {
+        float4 qx, qy, qz, qw;
+        detail::loadQuaternions4(q + i, qx, qy, qz, qw);
+        // The fourth row after the transpose is the x of v[i + 1 .. i + 4]; carrying it through
+        // the store transpose rewrites v[i + 4].x with its own value, which keeps out == v safe.
+        float4 vx = loadu4(&v[i].x), vy = loadu4(&v[i + 1].x), vz = loadu4(&v[i + 2].x), next = loadu4(&v[i + 3].x);
+        transpose4(vx, vy, vz, next);
+
+        float4 tx = mul4(two, sub4(mul4(qy, vz), mul4(qz, vy)));
+        float4 ty = mul4(two, sub4(mul4(qz, vx), mul4(qx, vz)));
+        float4 tz = mul4(two, sub4(mul4(qx, vy), mul4(qy, vx)));
+        float4 rx = add4(add4(vx, mul4(qw, tx)), sub4(mul4(qy, tz), mul4(qz, ty)));
+        float4 ry = add4(add4(vy, mul4(qw, ty)), sub4(mul4(qz, tx), mul4(qx, tz)));
+        float4 rz = add4(add4(vz, mul4(qw, tz)), sub4(mul4(qx, ty), mul4(qy, tx)));
+
+        transpose4(rx, ry, rz, next);
+        storeu4(&out[i].x, rx);
+        storeu4(&out[i + 1].x, ry);
+        storeu4(&out[i + 2].x, rz);
+        storeu4(&out[i + 3].x, next);
+      }
+#endif
+      for (; i < n; ++i) {
+        out[i] = q[i] * v[i];
+      }
+    }
+
+    /*
+      *  @brief Writes out[i] = a[i] * b[i], four products per SIMD step in SoA form.
+      *  out may be a or b; otherwise the arrays must not overlap.
+    */
+    inline void multiplyBatch(const Quaternion* a, const Quaternion* b, Quaternion* out, size_t n) {
+      size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      using namespace SIMD;
+      for (const size_t end = detail::simdEnd(n, 0); i < end; i += 4) {
+        float4 ax, ay, az, aw, bx, by, bz, bw;
+        detail::loadQuaternions4(a + i, ax, ay, az, aw);
+        detail::loadQuaternions4(b + i, bx, by, bz, bw);
+        float4 rx = sub4(add4(add4(mul4(aw, bx), mul4(ax, bw)), mul4(ay, bz)), mul4(az, by));
+        float4 ry = add4(add4(sub4(mul4(aw, by), mul4(ax, bz)), mul4(ay, bw)), mul4(az, bx));
+        float4 rz = add4(sub4(add4(mul4(aw, bz), mul4(ax, by)), mul4(ay, bx)), mul4(az, bw));
+        float4 rw = sub4(sub4(sub4(mul4(aw, bw), mul4(ax, bx)), mul4(ay, by)), mul4(az, bz));
+        detail::storeQuaternions4(out + i, rx, ry, rz, rw);
+      }
+#endif
+      for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+      }
+    }
+
+    /*
+      *  @brief Writes out[i] = q[i].normalized(), four quaternions per SIMD step in SoA form.
+      *  Quaternions shorter than EPSILON are copied unchanged, as in Quaternion::normalize.
+      *  out may be q; otherwise the arrays must not overlap.
+    */
+    inline void normalizeBatch(const Quaternion* q, Quaternion* out, size_t n) {
+      size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      using namespace SIMD;
+      const float4 epsSq = splat4(Math::EPSILON * Math::EPSILON);
+      const float4 one = splat4(1.0f);
+      for (const size_t end = detail::simdEnd(n, 0); i < end; i += 4) {
+        float4 x, y, z, w;
+        detail::loadQuaternions4(q + i, x, y, z, w);
+        float4 sq = add4(add4(mul4(x, x), mul4(y, y)), add4(mul4(z, z), mul4(w, w)));
+        float4 scale = select4(cmplt4(epsSq, sq), rsqrt4(sq), one);
+        detail::storeQuaternions4(out + i, mul4(x, scale), mul4(y, scale), mul4(z, scale), mul4(w, scale));
+      }
+#endif
+      for (; i < n; ++i) {
+        out[i] = q[i].normalized();
+      }
+    }
+
+  }
+}
@@ -0,0 +1,572 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineSIMD.h"
+#include "AABB.h"
+#include "Vector3.h"
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief Ray with an origin and a direction; points along it are origin + t * direction.
+      *  The direction need not be normalized: every distance the intersection tests return is
+      *  in units of the direction's length.
+    */
+    struct Ray {
+      Vectors::Vector3 origin;
+      Vectors::Vector3 direction;
+
+      /*
+        *  @brief Default constructor. Ray from the origin along +Z.
+      */
+      constexpr Ray() : origin(0.0f, 0.0f, 0.0f), direction(0.0f, 0.0f, 1.0f) {}
+
+      constexpr Ray(const Vectors::Vector3& inOrigin, const Vectors::Vector3& inDirection)
+        : origin(inOrigin), direction(inDirection) {}
+
+      /*
+        *  @brief Point at distance t along the ray.
+      */
+      constexpr Vectors::Vector3 pointAt(float t) const {
+        return Vectors::Vector3(origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t);
+      }
+
+      /*
+        *  @brief Per-axis reciprocal of the direction for the slab tests. Zero components become
+        *  a huge value of the same sign, so the tests never compute 0 * infinity.
+      */
+      inline Vectors::Vector3 inverseDirection() const {
+        return Vectors::Vector3(safeReciprocal(direction.x), safeReciprocal(direction.y), safeReciprocal(direction.z));
+      }
+
+      static inline float safeReciprocal(float value) {
+        const float HUGE_VALUE = 1e30f;
+        return Math::abs(value) > 1e-30f ? 1.0f / value : (value < 0.0f ? -HUGE_VALUE : HUGE_VALUE);
+      }
+    };
+
+    static_assert(std::is_trivially_copyable<Ray>::value, "Ray must be trivially copyable");
+
+    /*
+      *  @brief Distance returned by the scalar tests on a miss.
+    */
+    constexpr float RAY_MISS = std::numeric_limits<float>::infinity();
+
+    /*
+      *  @brief Smallest determinant (and hit distance) the triangle tests accept; rejects rays
+      *  parallel to the triangle plane and self-hits at the origin.
+    */
+    constexpr float RAY_TRIANGLE_EPSILON = 1e-7f;
+
+    /*
+      *  @brief Slab test of a ray against a box.
+      *  @param ray Ray to test.
+      *  @param invDirection ray.inverseDirection(), hoisted out of loops over many boxes.
+      *  @param box Box to test; must not be empty.
+      *  @param tMax Ignore hits further than this.
+      *  @return Entry distance (0 if the origin is inside), or RAY_MISS.
+    */
+    inline
+      float intersectAABB(const Ray& ray, const Vectors::Vector3& invDirection, const AABB& box,
+                          float tMax = RAY_MISS) {
+        float tx1 = (box.min.x - ray.origin.x) * invDirection.x;
+        float tx2 = (box.max.x - ray.origin.x) * invDirection.x;
+        float tNear = Math::EMin(tx1, tx2);
+        float tFar = Math::EMax(tx1, tx2);
+        float ty1 = (box.min.y - ray.origin.y) * invDirection.y;
+        float ty2 = (box.max.y - ray.origin.y) * invDirection.y;
+        tNear = Math::EMax(tNear, Math::EMin(ty1, ty2));
+        tFar = Math::EMin(tFar, Math::EMax(ty1, ty2));
+        float tz1 = (box.min.z - ray.origin.z) * invDirection.z;
+        float tz2 = (box.max.z - ray.origin.z) * invDirection.z;
+        tNear = Math::EMax(tNear, Math::EMin(tz1, tz2));
+        tFar = Math::EMin(tFar, Math::EMax(tz1, tz2));
+        tNear = Math::EMax(tNear, 0.0f);
+        return (tNear <= tFar && tNear <= tMax) ? tNear : RAY_MISS;
+      }
+
+    inline
+      float intersectAABB(const Ray& ray, const AABB& box, float tMax = RAY_MISS) {
+        return intersectAABB(ray, ray.inverseDirection(), box, tMax);
+      }
+
+    /*
+      *  @brief Moller-Trumbore ray / triangle test (both faces).
+      *  @param ray Ray to test.
+      *  @param v0 First vertex.
+      *  @param v1 Second vertex.
+      *  @param v2 Third vertex.
+      *  @param tMax Ignore hits further than this.
+      *  @param u Optional output barycentric weight of v1.
+      *  @param v Optional output barycentric weight of v2.
+      *  @return Hit distance, or RAY_MISS.
+    */
+    inline
+      float intersectTriangle(const Ray& ray, const Vectors::Vector3& v0, const Vectors::Vector3& v1,
+                              const Vectors::Vector3& v2, float tMax = RAY_MISS, float* u = nullptr,
+                              float* v = nullptr) {
+        Vectors::Vector3 edge1 = v1 - v0;
+        Vectors::Vector3 edge2 = v2 - v0;
+        Vectors::Vector3 p = ray.direction.cross(edge2);
+        float det = edge1.dot(p);
+        if (Math::abs(det) < RAY_TRIANGLE_EPSILON) {
+          return RAY_MISS;
+        }
+        float invDet = 1.0f / det;
+        Vectors::Vector3 s = ray.origin - v0;
+        float bu = s.dot(p) * invDet;
+        if (bu < 0.0f || bu > 1.0f) {
+          return RAY_MISS;
+        }
+        Vectors::Vector3 q = s.cross(edge1);
+        float bv = ray.direction.dot(q) * invDet;
+        if (bv < 0.0f || bu + bv > 1.0f) {
+          return RAY_MISS;
+        }
+        float t = edge2.dot(q) * invDet;
+        if (t < RAY_TRIANGLE_EPSILON || t > tMax) {
+          return RAY_MISS;
+        }
+        if (u) *u = bu;
+        if (v) *v = bv;
+        return t;
+      }
+
+    /*
+      *  @brief N rays in structure-of-arrays form for the packet tests (N = 4 or 8).
+      *  Lanes that are not set hold meaningless results; mask them off with the returned bits.
+    */
+    template <int N>
+    struct RayPacket {
+      float originX[N], originY[N], originZ[N];
+      float directionX[N], directionY[N], directionZ[N];
+      float invDirectionX[N], invDirectionY[N], invDirectionZ[N];
+
+      inline RayPacket() {
+        for (int lane = 0; lane < N; ++lane) {
+          set(lane, Ray());
+        }
+      }
+
+      inline void set(int lane, const Ray& ray) {
+        Vectors::Vector3 inv = ray.inverseDirection();
+        originX[lane] = ray.origin.x;
+        originY[lane] = ray.origin.y;
+        originZ[lane] = ray.origin.z;
+        directionX[lane] = ray.direction.x;
+        directionY[lane] = ray.direction.y;
+        directionZ[lane] = ray.direction.z;
+        invDirectionX[lane] = inv.x;
+        invDirectionY[lane] = inv.y;
+        invDirectionZ[lane] = inv.z;
+      }
+
+      inline Ray get(int lane) const {
+        return Ray(Vectors::Vector3(originX[lane], originY[lane], originZ[lane]),
+                   Vectors::Vector3(directionX[lane], directionY[lane], directionZ[lane]));
+      }
+    };
+
+    /*
+      *  @brief N triangles in structure-of-arrays form (first vertex and the two edges from it).
+      *  Unset lanes are degenerate and never hit.
+    */
+    template <int N>
+    struct TrianglePacket {
+      float v0X[N], v0Y[N], v0Z[N];
+      float edge1X[N], edge1Y[N], edge1Z[N];
+      float edge2X[N], edge2Y[N], edge2Z[N];
+
+      inline TrianglePacket() {
+        Vectors::Vector3 zero;
+        for (int lane = 0; lane < N; ++lane) {
+          set(lane, zero, zero, zero);
+        }
+      }
+
+      inline void set(int lane, const Vectors::Vector3& v0, const Vectors::Vector3& v1, const Vectors::Vector3& v2) {
+        v0X[lane] = v0.x;
+        v0Y[lane] = v0.y;
+        v0Z[lane] = v0.z;
+        edge1X[lane] = v1.x - v0.x;
+        edge1Y[lane] = v1.y - v0.y;
+        edge1Z[lane] = v1.z - v0.z;
+        edge2X[lane] = v2.x - v0.x;
+        edge2Y[lane] = v2.y - v0.y;
+        edge2Z[lane] = v2.z - v0.z;
+      }
+    };
+
+    /*
+      *  @brief N boxes in structure-of-arrays form. Unset lanes hold NaN bounds, which fail every
+      *  comparison of the slab test and so never hit (an empty AABB would: its inverted slabs
+      *  cover the whole line).
+    */
+    template <int N>
+    struct AABBPacket {
+      float minX[N], minY[N], minZ[N];
+      float maxX[N], maxY[N], maxZ[N];
+
+      inline AABBPacket() {
+        const float NOT_A_NUMBER = std::numeric_limits<float>::quiet_NaN();
+        for (int lane = 0; lane < N; ++lane) {
+          minX[lane] = minY[lane] = minZ[lane] = NOT_A_NUMBER;
+          maxX[lane] = maxY[lane] = maxZ[lane] = NOT_A_NUMBER;
+        }
+      }
+
+      inline void set(int lane, const AABB& box) {
+        minX[lane] = box.min.x;
+        minY[lane] = box.min.y;
+        minZ[lane] = box.min.z;
+        maxX[lane] = box.max.x;
+        maxY[lane] = box.max.y;
+        maxZ[lane] = box.max.z;
+      }
+    };
+
+    using RayPacket4 = RayPacket<4>;
+    using RayPacket8 = RayPacket<8>;
+    using TrianglePacket4 = TrianglePacket<4>;
+    using TrianglePacket8 = TrianglePacket<8>;
+    using AABBPacket4 = AABBPacket<4>;
+    using AABBPacket8 = AABBPacket<8>;
+
+    namespace detail {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      /*
+        *  @brief Moller-Trumbore on four lanes. Any operand may be a splatted scalar, so the same
+        *  kernel serves four rays against one triangle and one ray against four triangles.
+        *  @return Hit mask (bit i = lane i); t receives the hit distance of every lane.
+      */
+      inline
+        int triangleLanes4(SIMD::float4 ox, SIMD::float4 oy, SIMD::float4 oz,
+                           SIMD::float4 dx, SIMD::float4 dy, SIMD::float4 dz,
+                           SIMD::float4 v0x, SIMD::float4 v0y, SIMD::float4 v0z,
+                           SIMD::float4 e1x, SIMD::float4 e1y, SIMD::float4 e1z,
+                           SIMD::float4 e2x, SIMD::float4 e2y, SIMD::float4 e2z,
+                           float tMax, float* t) {
+          using namespace SIMD;
+          float4 zero = splat4(0.0f);
+          float4 one = splat4(1.0f);
+          float4 epsilon = splat4(RAY_TRIANGLE_EPSILON);
+          // p = d x e2, det = e1 . p
+          float4 px = sub4(mul4(dy, e2z), mul4(dz, e2y));
+          float4 py = sub4(mul4(dz, e2x), mul4(dx, e2z));
+          float4 pz = sub4(mul4(dx, e2y), mul4(dy, e2x));
+          float4 det = add4(add4(mul4(e1x, px), mul4(e1y, py)), mul4(e1z, pz));
+          float4 valid = cmpge4(abs4(det), epsilon);
+          float4 invDet = div4(one, det);
+          // s = o - v0, u = (s . p) / det
+          float4 sx = sub4(ox, v0x), sy = sub4(oy, v0y), sz = sub4(oz, v0z);
+          float4 u = mul4(add4(add4(mul4(sx, px), mul4(sy, py)), mul4(sz, pz)), invDet);
+          valid = and4(valid, and4(cmpge4(u, zero), cmpge4(one, u)));
+          // q = s x e1, v = (d . q) / det, t = (e2 . q) / det
+          float4 qx = sub4(mul4(sy, e1z), mul4(sz, e1y));
+          float4 qy = sub4(mul4(sz, e1x), mul4(sx, e1z));
+          float4 qz = sub4(mul4(sx, e1y), mul4(sy, e1x));
+          float4 v = mul4(add4(add4(mul4(dx, qx), mul4(dy, qy)), mul4(dz, qz)), invDet);
+          valid = and4(valid, and4(cmpge4(v, zero), cmpge4(one, add4(u, v))));
+          float4 dist = mul4(add4(add4(mul4(e2x, qx), mul4(e2y, qy)), mul4(e2z, qz)), invDet);
+          valid = and4(valid, and4(cmpge4(dist, epsilon), cmpge4(splat4(tMax), dist)));
+          storeu4(t, dist);
+          return movemask4(valid);
+        }
+
+      /*
+        *  @brief Slab test on four lanes; operands may be splatted scalars like triangleLanes4.
+      */
+      inline
+        int slabLanes4(SIMD::float4 ox, SIMD::float4 oy, SIMD::float4 oz,
+                       SIMD::float4 ix, SIMD::float4 iy, SIMD::float4 iz,
+                       SIMD::float4 minX, SIMD::float4 minY, SIMD::float4 minZ,
+                       SIMD::float4 maxX, SIMD::float4 maxY, SIMD::float4 maxZ,
+                       float tMax, float* t) {
+          using namespace SIMD;
+          float4 tx1 = mul4(sub4(minX, ox), ix), tx2 = mul4(sub4(maxX, ox), ix);
+          float4 ty1 = mul4(sub4(minY, oy), iy), ty2 = mul4(sub4(maxY, oy), iy);
+          float4 tz1 = mul4(sub4(minZ, oz), iz), tz2 = mul4(sub4(maxZ, oz), iz);
+          float4 tNear = max4(max4(min4(tx1, tx2), min4(ty1, ty2)), max4(min4(tz1, tz2), splat4(0.0f)));
+          float4 tFar = min4(min4(max4(tx1, tx2), max4(ty1, ty2)), max4(tz1, tz2));
+          float4 valid = and4(cmpge4(tFar, tNear), cmpge4(splat4(tMax), tNear));
+          storeu4(t, tNear);
+          return movemask4(valid);
+        }
+#endif
+
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+      /*
+        *  @brief AVX2 versions of triangleLanes4 / slabLanes4 on eight lanes.
+      */
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int triangleLanes8(__m256 ox, __m256 oy, __m256 oz, __m256 dx, __m256 dy, __m256 dz,
+                           __m256 v0x, __m256 v0y, __m256 v0z, __m256 e1x, __m256 e1y, __m256 e1z,
+                           __m256 e2x, __m256 e2y, __m256 e2z, float tMax, float* t) {
+          __m256 zero = _mm256_setzero_ps();
+          __m256 one = _mm256_set1_ps(1.0f);
+          __m256 epsilon = _mm256_set1_ps(RAY_TRIANGLE_EPSILON);
+          __m256 px = _mm256_fmsub_ps(dy, e2z, _mm256_mul_ps(dz, e2y));
+          __m256 py = _mm256_fmsub_ps(dz, e2x, _mm256_mul_ps(dx, e2z));
+          __m256 pz = _mm256_fmsub_ps(dx, e2y, _mm256_mul_ps(dy, e2x));
+          __m256 det = _mm256_fmadd_ps(e1x, px, _mm256_fmadd_ps(e1y, py, _mm256_mul_ps(e1z, pz)));
+          __m256 absDet = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), det);
+          __m256 valid = _mm256_cmp_ps(absDet, epsilon, _CMP_GE_OQ);
+          __m256 invDet = _mm256_div_ps(one, det);
+          __m256 sx = _mm256_sub_ps(ox, v0x), sy = _mm256_sub_ps(oy, v0y), sz = _mm256_sub_ps(oz, v0z);
+          __m256 u = _mm256_mul_ps(_mm256_fmadd_ps(sx, px, _mm256_fmadd_ps(sy, py, _mm256_mul_ps(sz, pz))), invDet);
+          valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(one, u, _CMP_GE_OQ)));
+          __m256 qx = _mm256_fmsub_ps(sy, e1z, _mm256_mul_ps(sz, e1y));
+          __m256 qy = _mm256_fmsub_ps(sz, e1x, _mm256_mul_ps(sx, e1z));
+          __m256 qz = _mm256_fmsub_ps(sx, e1y, _mm256_mul_ps(sy, e1x));
+          __m256 v = _mm256_mul_ps(_mm256_fmadd_ps(dx, qx, _mm256_fmadd_ps(dy, qy, _mm256_mul_ps(dz, qz))), invDet);
+          valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(v, zero, _CMP_GE_OQ),
+                                                     _mm256_cmp_ps(one, _mm256_add_ps(u, v), _CMP_GE_OQ)));
+          __m256 dist = _mm256_mul_ps(_mm256_fmadd_ps(e2x, qx, _mm256_fmadd_ps(e2y, qy, _mm256_mul_ps(e2z, qz))), invDet);
+          valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(dist, epsilon, _CMP_GE_OQ),
+                                                     _mm256_cmp_ps(_mm256_set1_ps(tMax), dist, _CMP_GE_OQ)));
+          _mm256_storeu_ps(t, dist);
+          return _mm256_movemask_ps(valid);
+        }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int slabLanes8(__m256 ox, __m256 oy, __m256 oz, __m256 ix, __m256 iy, __m256 iz,
+                       __m256 minX, __m256 minY, __m256 minZ, __m256 maxX, __m256 maxY, __m256 maxZ,
+                       float tMax, float* t) {
+          __m256 tx1 = _mm256_mul_ps(_mm256_sub_ps(minX, ox), ix), tx2 = _mm256_mul_ps(_mm256_sub_ps(maxX, ox), ix);
+          __m256 ty1 = _mm256_mul_ps(_mm256_sub_ps(minY, oy), iy), ty2 = _mm256_mul_ps(_mm256_sub_ps(maxY, oy), iy);
+          __m256 tz1 = _mm256_mul_ps(_mm256_sub_ps(minZ, oz), iz), tz2 = _mm256_mul_ps(_mm256_sub_ps(maxZ, oz), iz);
+          __m256 tNear = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(tx1, tx2), _mm256_min_ps(ty1, ty2)),
+                                       _mm256_max_ps(_mm256_min_ps(tz1, tz2), _mm256_setzero_ps()));
+          __m256 tFar = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(tx1, tx2), _mm256_max_ps(ty1, ty2)),
+                                      _mm256_max_ps(tz1, tz2));
+          __m256 valid = _mm256_and_ps(_mm256_cmp_ps(tFar, tNear, _CMP_GE_OQ),
+                                       _mm256_cmp_ps(_mm256_set1_ps(tMax), tNear, _CMP_GE_OQ));
+          _mm256_storeu_ps(t, tNear);
+          return _mm256_movemask_ps(valid);
+        }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int raysTriangle8AVX2(const RayPacket8& rays, const Vectors::Vector3& v0, const Vectors::Vector3& v1,
+                              const Vectors::Vector3& v2, float tMax, float* t) {
+          return triangleLanes8(_mm256_loadu_ps(rays.originX), _mm256_loadu_ps(rays.originY), _mm256_loadu_ps(rays.originZ),
+                                _mm256_loadu_ps(rays.directionX), _mm256_loadu_ps(rays.directionY),
+                                _mm256_loadu_ps(rays.directionZ),
+                                _mm256_set1_ps(v0.x), _mm256_set1_ps(v0.y), _mm256_set1_ps(v0.z),
+                                _mm256_set1_ps(v1.x - v0.x), _mm256_set1_ps(v1.y - v0.y), _mm256_set1_ps(v1.z - v0.z),
+                                _mm256_set1_ps(v2.x - v0.x), _mm256_set1_ps(v2.y - v0.y), _mm256_set1_ps(v2.z - v0.z),
+                                tMax, t);
+        }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int rayTriangles8AVX2(const Ray& ray, const TrianglePacket8& tris, float tMax, float* t) {
+          return triangleLanes8(_mm256_set1_ps(ray.origin.x), _mm256_set1_ps(ray.origin.y), _mm256_set1_ps(ray.origin.z),
+                                _mm256_set1_ps(ray.direction.x), _mm256_set1_ps(ray.direction.y),
+                                _mm256_set1_ps(ray.direction.z),
+                                _mm256_loadu_ps(tris.v0X), _mm256_loadu_ps(tris.v0Y), _mm256_loadu_ps(tris.v0Z),
+                                _mm256_loadu_ps(tris.edge1X), _mm256_loadu_ps(tris.edge1Y), _mm256_loadu_ps(tris.edge1Z),
+                                _mm256_loadu_ps(tris.edge2X), _mm256_loadu_ps(tris.edge2Y), _mm256_loadu_ps(tris.edge2Z),
+                                tMax, t);
+        }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int raysAABB8AVX2(const RayPacket8& rays, const AABB& box, float tMax, float* t) {
+          return slabLanes8(_mm256_loadu_ps(rays.originX), _mm256_loadu_ps(rays.originY), _mm256_loadu_ps(rays.originZ),
+                            _mm256_loadu_ps(rays.invDirectionX), _mm256_loadu_ps(rays.invDirectionY),
+                            _mm256_loadu_ps(rays.invDirectionZ),
+                            _mm256_set1_ps(box.min.x), _mm256_set1_ps(box.min.y), _mm256_set1_ps(box.min.z),
+                            _mm256_set1_ps(box.max.x), _mm256_set1_ps(box.max.y), _mm256_set1_ps(box.max.z), tMax, t);
+        }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline
+        int rayAABBs8AVX2(const Ray& ray, const Vectors::Vector3& inv, const AABBPacket8& boxes, float tMax, float* t) {
+          return slabLanes8(_mm256_set1_ps(ray.origin.x), _mm256_set1_ps(ray.origin.y), _mm256_set1_ps(ray.origin.z),
+                            _mm256_set1_ps(inv.x), _mm256_set1_ps(inv.y), _mm256_set1_ps(inv.z),
+                            _mm256_loadu_ps(boxes.minX), _mm256_loadu_ps(boxes.minY), _mm256_loadu_ps(boxes.minZ),
+                            _mm256_loadu_ps(boxes.maxX), _mm256_loadu_ps(boxes.maxY), _mm256_loadu_ps(boxes.maxZ), tMax, t);
+        }
+#endif
+
+      /*
+        *  @brief Four-lane packet tests starting at lane `first` of an N-lane packet
+        *  (N = 4, or one half of an 8-lane packet without AVX2).
+      */
+      template <int N>
+      inline
+        int raysTriangle4(const RayPacket<N>& rays, int first, const Vectors::Vector3& v0, const Vectors::Vector3& v1,
+                          const Vectors::Vector3& v2, float tMax, float* t) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          using namespace SIMD;
+          return triangleLanes4(loadu4(rays.originX + first), loadu4(rays.originY + first), loadu4(rays.originZ + first),
+                                loadu4(rays.directionX + first), loadu4(rays.directionY + first),
+                                loadu4(rays.directionZ + first),
+                                splat4(v0.x), splat4(v0.y), splat4(v0.z),
+                                splat4(v1.x - v0.x), splat4(v1.y - v0.y), splat4(v1.z - v0.z),
+                                splat4(v2.x - v0.x), splat4(v2.y - v0.y), splat4(v2.z - v0.z), tMax, t);
+#else
+          int mask = 0;
+          for (int lane = 0; lane < 4; ++lane) {
+            t[lane] = intersectTriangle(rays.get(first + lane), v0, v1, v2, tMax);
+            mask |= (t[lane] != RAY_MISS) << lane;
+          }
+          return mask;
+#endif
+        }
+
+      template <int N>
+      inline
+        int rayTriangles4(const Ray& ray, const TrianglePacket<N>& tris, int first, float tMax, float* t) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          using namespace SIMD;
+          return triangleLanes4(splat4(ray.origin.x), splat4(ray.origin.y), splat4(ray.origin.z),
+                                splat4(ray.direction.x), splat4(ray.direction.y), splat4(ray.direction.z),
+                                loadu4(tris.v0X + first), loadu4(tris.v0Y + first), loadu4(tris.v0Z + first),
+                                loadu4(tris.edge1X + first), loadu4(tris.edge1Y + first), loadu4(tris.edge1Z + first),
+                                loadu4(tris.edge2X + first), loadu4(tris.edge2Y + first), loadu4(tris.edge2Z + first),
+                                tMax, t);
+#else
+          int mask = 0;
+          for (int lane = 0; lane < 4; ++lane) {
+            int i = first + lane;
+            Vectors::Vector3 v0(tris.v0X[i], tris.v0Y[i], tris.v0Z[i]);
+            Vectors::Vector3 v1(v0.x + tris.edge1X[i], v0.y + tris.edge1Y[i], v0.z + tris.edge1Z[i]);
+            Vectors::Vector3 v2(v0.x + tris.edge2X[i], v0.y + tris.edge2Y[i], v0.z + tris.edge2Z[i]);
+            t[lane] = intersectTriangle(ray, v0, v1, v2, tMax);
+            mask |= (t[lane] != RAY_MISS) << lane;
+          }
+          return mask;
+#endif
+        }
+
+      template <int N>
+      inline
+        int raysAABB4(const RayPacket<N>& rays, int first, const AABB& box, float tMax, float* t) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          using namespace SIMD;
+          return slabLanes4(loadu4(rays.originX + first), loadu4(rays.originY + first), loadu4(rays.originZ + first),
+                            loadu4(rays.invDirectionX + first), loadu4(rays.invDirectionY + first),
+                            loadu4(rays.invDirectionZ + first),
+                            splat4(box.min.x), splat4(box.min.y), splat4(box.min.z),
+                            splat4(box.max.x), splat4(box.max.y), splat4(box.max.z), tMax, t);
+#else
+          int mask = 0;
+          for (int lane = 0; lane < 4; ++lane) {
+            int i = first + lane;
+            Ray ray = rays.get(i);
+            Vectors::Vector3 inv(rays.invDirectionX[i], rays.invDirectionY[i], rays.invDirectionZ[i]);
+            t[lane] = intersectAABB(ray, inv, box, tMax);
+            mask |= (t[lane] != RAY_MISS) << lane;
+          }
+          return mask;
+#endif
+        }
+
+      template <int N>
+      inline
+        int rayAABBs4(const Ray& ray, const Vectors::Vector3& inv, const AABBPacket<N>& boxes, int first, float tMax,
+                      float* t) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+          using namespace SIMD;
+          return slabLanes4(splat4(ray.origin.x), splat4(ray.origin.y), splat4(ray.origin.z),
+                            splat4(inv.x), splat4(inv.y), splat4(inv.z),
+                            loadu4(boxes.minX + first), loadu4(boxes.minY + first), loadu4(boxes.minZ + first),
+                            loadu4(boxes.maxX + first), loadu4(boxes.maxY + first), loadu4(boxes.maxZ + first), tMax, t);
+#else
+          int mask = 0;
+          for (int lane = 0; lane < 4; ++lane) {
+            int i = first + lane;
+            AABB box(Vectors::Vector3(boxes.minX[i], boxes.minY[i], boxes.minZ[i]),
+                     Vectors::Vector3(boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]));
+            t[lane] = intersectAABB(ray, inv, box, tMax);
+            mask |= (t[lane] != RAY_MISS) << lane;
+          }
+          return mask;
+#endif
+        }
+    }
+
+    /*
+      *  @brief Packet tests: four or eight rays against one primitive, or one ray against four or
+      *  eight primitives, one SIMD lane each (SSE2 / NEON; AVX2 for eight lanes when the CPU has it).
+      *  @param tMax Ignore hits further than this.
+      *  @param t Output distance per lane (meaningful only where the mask bit is set).
+      *  @return Hit mask, bit i = lane i.
+    */
+    inline
+      int intersectTriangle(const RayPacket4& rays, const Vectors::Vector3& v0, const Vectors::Vector3& v1,
+                            const Vectors::Vector3& v2, float tMax, float t[4]) {
+        return detail::raysTriangle4(rays, 0, v0, v1, v2, tMax, t);
+      }
+
+    inline
+      int intersectTriangle(const RayPacket8& rays, const Vectors::Vector3& v0, const Vectors::Vector3& v1,
+                            const Vectors::Vector3& v2, float tMax, float t[8]) {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          return detail::raysTriangle8AVX2(rays, v0, v1, v2, tMax, t);
+        }
+#endif
+        return detail::raysTriangle4(rays, 0, v0, v1, v2, tMax, t) |
+               (detail::raysTriangle4(rays, 4, v0, v1, v2, tMax, t + 4) << 4);
+      }
+
+    inline
+      int intersectTriangles(const Ray& ray, const TrianglePacket4& tris, float tMax, float t[4]) {
+        return detail::rayTriangles4(ray, tris, 0, tMax, t);
+      }
+
+    inline
+      int intersectTriangles(const Ray& ray, const TrianglePacket8& tris, float tMax, float t[8]) {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          return detail::rayTriangles8AVX2(ray, tris, tMax, t);
+        }
+#endif
+        return detail::rayTriangles4(ray, tris, 0, tMax, t) | (detail::rayTriangles4(ray, tris, 4, tMax, t + 4) << 4);
+      }
+
+    inline
+      int intersectAABB(const RayPacket4& rays, const AABB& box, float tMax, float t[4]) {
+        return detail::raysAABB4(rays, 0, box, tMax, t);
+      }
+
+    inline
+      int intersectAABB(const RayPacket8& rays, const AABB& box, float tMax, float t[8]) {
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          return detail::raysAABB8AVX2(rays, box, tMax, t);
+        }
+#endif
+        return detail::raysAABB4(rays, 0, box, tMax, t) | (detail::raysAABB4(rays, 4, box, tMax, t + 4) << 4);
+      }
+
+    inline
+      int intersectAABBs(const Ray& ray, const AABBPacket4& boxes, float tMax, float t[4]) {
+        return detail::rayAABBs4(ray, ray.inverseDirection(), boxes, 0, tMax, t);
+      }
+
+    inline
+      int intersectAABBs(const Ray& ray, const AABBPacket8& boxes, float tMax, float t[8]) {
+        Vectors::Vector3 inv = ray.inverseDirection();
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          return detail::rayAABBs8AVX2(ray, inv, boxes, tMax, t);
+        }
+#endif
+        return detail::rayAABBs4(ray, inv, boxes, 0, tMax, t) | (detail::rayAABBs4(ray, inv, boxes, 4, tMax, t + 4) << 4);
+      }
+
+    /*
+      *  @brief Output stream operator for Ray.
+    */
+    inline std::ostream& operator<<(std::ostream& os, const Ray& ray) {
+      os << "Ray(origin:" << ray.origin << ", direction:" << ray.direction << ")";
+      return os;
+    }
+
+  }
+}
@@ -0,0 +1,399 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "Vector3.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Geometry {
+
+    /*
+      *  @brief Uniform grid over Vector3 positions with hashed cells, for radius and k-nearest queries.
+      *  build() sorts the points by cell bucket (a stable parallel radix sort), so the contents of
+      *  every bucket are one contiguous range of a flat array: bucket b holds the sorted points
+      *  [cellStart[b], cellStart[b + 1]). Points are copied in that order, so a query streams
+      *  through memory. Distinct cells may share a bucket; queries check each candidate's cell,
+      *  so results never contain duplicates. Every comparison uses squared distances.
+    */
+    class SpatialHashGrid {
+    public:
+      /*
+        *  @brief Point count above which build() splits its passes across threads.
+      */
+      static constexpr size_t PARALLEL_BUILD_THRESHOLD = 16384;
+
+      /*
+        *  @brief Index reported by queryNearest when nothing is in range.
+      */
+      static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+      /*
+        *  @brief One query result: original point index and squared distance to the query center.
+      */
+      struct Neighbor {
+        uint32_t index;
+        float squareDistance;
+      };
+
+      /*
+        *  @brief Constructor.
+        *  @param cellSize Edge length of a cell; about the typical query radius works best.
+      */
+      inline explicit SpatialHashGrid(float cellSize = 1.0f) { setCellSize(cellSize); }
+
+      /*
+        *  @brief Changes the cell size; takes effect at the next build().
+      */
+      inline void setCellSize(float cellSize) {
+        m_cellSize = cellSize > Math::EPSILON ? cellSize : Math::EPSILON;
+        m_invCellSize = 1.0f / m_cellSize;
+      }
+
+      inline float cellSize() const { return m_cellSize; }
+      inline size_t size() const { return m_indices.size(); }
+      inline bool empty() const { return m_indices.empty(); }
+
+      /*
+        *  @brief Rebuilds the grid over n positions. Point i of every query is positions[i].
+        *  Positions must lie within +-2^31 cells of the origin.
+      */
+      inline void build(const Vectors::Vector3* positions, size_t n) {
+        m_positions.resize(n);
+        m_indices.resize(n);
+        if (n == 0) {
+          m_cellStart.assign(2, 0);
+          m_bucketBits = 0;
+          return;
+        }
+
+        m_bucketBits = 1;
+        while ((size_t(1) << m_bucketBits) < n) {
+          ++m_bucketBits;
+        }
+        const uint32_t bucketCount = uint32_t(1) << m_bucketBits;
+        const size_t chunkCount = chunksFor(n);
+        const size_t chunkSize = (n + chunkCount - 1) / chunkCount;
+
+        // Bucket of every point, and the range of occupied cells.
+        std::vector<uint32_t> keys(n), order(n);
+        std::vector<Cell> chunkMin(chunkCount), chunkMax(chunkCount);
+        Parallel::parallelFor(0, chunkCount, 1, [&](size_t cBegin, size_t cEnd) {
+          for (size_t c = cBegin; c < cEnd; ++c) {
+            Cell lo = { INT32_MAX, INT32_MAX, INT32_MAX };
+            Cell hi = { INT32_MIN, INT32_MIN, INT32_MIN };
+            for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); ++i) {
+              Cell cell = cellOf(positions[i]);
+              lo = { std::min(lo.x, cell.x), std::min(lo.y, cell.y), std::min(lo.z, cell.z) };
+              hi = { std::max(hi.x, cell.x), std::max(hi.y, cell.y), std::max(hi.z, cell.z) };
+              keys[i] = bucketOf(cell);
+              order[i] = static_cast<uint32_t>(i);
+            }
+            chunkMin[c] = lo;
+            chunkMax[c] = hi;
+          }
+        });
+        m_cellMin = chunkMin[0];
+        m_cellMax = chunkMax[0];
+        for (size_t c = 1; c < chunkCount; ++c) {
+          m_cellMin = { std::min(m_cellMin.x, chunkMin[c].x), std::min(m_cellMin.y, chunkMin[c].y),
+                        std::min(m_cellMin.z, chunkMin[c].z) };
+          m_cellMax = { std::max(m_cellMax.x, chunkMax[c].x), std::max(m_cellMax.y, chunkMax[c].y),
+                        std::max(m_cellMax.z, chunkMax[c].z) };
+        }
+
+        radixSort(keys, order, chunkCount, chunkSize);
+
+        // cellStart[b] = first sorted slot with key >= b; every entry is written exactly once.
+        m_cellStart.resize(size_t(bucketCount) + 1);
+        Parallel::parallelFor(0, n, PARALLEL_BUILD_THRESHOLD, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            uint32_t previous = i == 0 ? 0 : keys[i - 1] + 1;
+            for (uint32_t b = previous; b <= keys[i]; ++b) {
+              m_cellStart[b] = static_cast<uint32_t>(i);
+            }
+            m_positions[i] = positions[order[i]];
+            m_indices[i] = order[i];
+          }
+        });
+        for (uint32_t b = keys[n - 1] + 1; b <= bucketCount; ++b) {
+          m_cellStart[b] = static_cast<uint32_t>(n);
+        }
+      }
+
+      /*
+        *  @brief Calls fn(uint32_t index, float squareDistance) for every point within radius of center
+        *  (boundary included), in no particular order.
+        *  @return Number of points found.
+      */
+      template <typename Fn>
+      inline size_t queryRadius(const Vectors::Vector3& center, float radius, Fn&& fn) const {
+        if (empty() || radius < 0.0f) {
+          return 0;
+        }
+        const float radiusSq = radius * radius;
+        const Cell lo = clampedCellOf(Vectors::Vector3(center.x - radius, center.y - radius, center.z - radius));
+        const Cell hi = clampedCellOf(Vectors::Vector3(center.x + radius, center.y + radius, center.z + radius));
+
+        size_t found = 0;
+        for (int32_t x = lo.x; x <= hi.x; ++x) {
+          for (int32_t y = lo.y; y <= hi.y; ++y) {
+            for (int32_t z = lo.z; z <= hi.z; ++z) {
+              visitCell({ x, y, z }, center, radiusSq, [&](uint32_t slot, float squareDistance) {
+                fn(m_indices[slot], squareDistance);
+                ++found;
+              });
+            }
+          }
+        }
+        return found;
+      }
+
+      /*
+        *  @brief Appends the indices of every point within radius of center to out.
+        *  @return Number of points found.
+      */
+      inline size_t queryRadius(const Vectors::Vector3& center, float radius, std::vector<uint32_t>& out) const {
+        return queryRadius(center, radius, [&out](uint32_t index, float) { out.push_back(index); });
+      }
+
+      /*
+        *  @brief The k points closest to center (at most maxRadius away), nearest first; ties go to
+        *  the lower index.
+        *  @param out Cleared and filled with up to k neighbors.
+        *  @return Number of neighbors found.
+      */
+      inline size_t queryKNearest(const Vectors::Vector3& center, size_t k, std::vector<Neighbor>& out,
+                                  float maxRadius = std::numeric_limits<float>::infinity()) const {
+        out.resize(std::min(k, size()));
+        out.resize(searchNearest(center, out.data(), out.size(), maxRadius));
+        return out.size();
+      }
+
+      /*
+        *  @brief Closest point to center, or { INVALID_INDEX, +inf } if nothing lies within maxRadius.
+      */
+      inline Neighbor queryNearest(const Vectors::Vector3& center,
+                                   float maxRadius = std::numeric_limits<float>::infinity()) const {
+        Neighbor best = { INVALID_INDEX, std::numeric_limits<float>::infinity() };
+        searchNearest(center, &best, 1, maxRadius);
+        return best;
+      }
+
+    private:
+      struct Cell {
+        int32_t x, y, z;
+      };
+
+      static inline bool closer(const Neighbor& a, const Neighbor& b) {
+        return a.squareDistance < b.squareDistance || (a.squareDistance == b.squareDistance && a.index < b.index);
+      }
+
+      inline Cell cellOf(const Vectors::Vector3& p) const {
+        return { static_cast<int32_t>(Math::floor(p.x * m_invCellSize)),
+                 static_cast<int32_t>(Math::floor(p.y * m_invCellSize)),
+                 static_cast<int32_t>(Math::floor(p.z * m_invCellSize)) };
+      }
+
+      /*
+        *  @brief Cell of p clamped to the occupied cell range, safe for points far outside it.
+      */
+      inline Cell clampedCellOf(const Vectors::Vector3& p) const {
+        auto clampAxis = [this](float v, int32_t lo, int32_t hi) {
+          float cell = Math::floor(v * m_invCellSize);
+          return cell <= lo ? lo : (cell >= hi ? hi : static_cast<int32_t>(cell));
+        };
+        return { clampAxis(p.x, m_cellMin.x, m_cellMax.x), clampAxis(p.y, m_cellMin.y, m_cellMax.y),
+                 clampAxis(p.z, m_cellMin.z, m_cellMax.z) };
+      }
+
+      static inline int32_t& component(Cell& cell, int axis) {
+        return axis == 0 ? cell.x : (axis == 1 ? cell.y : cell.z);
+      }
+
+      static inline int32_t component(const Cell& cell, int axis) {
+        return axis == 0 ? cell.x : (axis == 1 ? cell.y : cell.z);
+      }
+
+      /*
+        *  @brief Squared distance from p to the block of cells [lo, hi].
+      */
+      inline float squareDistanceToCells(const Vectors::Vector3& p, const Cell& lo, const Cell& hi) const {
+        auto gap = [this](float v, int32_t cellLo, int32_t cellHi) {
+          float below = cellLo * m_cellSize - v;
+          float above = v - (cellHi + 1) * m_cellSize;
+          return Math::EMax(Math::EMax(below, above), 0.0f);
+        };
+        float dx = gap(p.x, lo.x, hi.x), dy = gap(p.y, lo.y, hi.y), dz = gap(p.z, lo.z, hi.z);
+        return dx * dx + dy * dy + dz * dz;
+      }
+
+      inline uint32_t bucketOf(const Cell& cell) const {
+        uint32_t h = (static_cast<uint32_t>(cell.x) * 73856093u) ^ (static_cast<uint32_t>(cell.y) * 19349663u) ^
+                     (static_cast<uint32_t>(cell.z) * 83492791u);
+        // Fold the high bits in so small tables still see every coordinate bit.
+        h ^= h >> 16;
+        h *= 0x7FEB352Du;
+        h ^= h >> 15;
+        return h & ((uint32_t(1) << m_bucketBits) - 1);
+      }
+
+      /*
+        *  @brief Calls accept(slot, squareDistance) for every point of one cell no further than
+        *  limitSq. Other cells sharing the bucket are filtered out by recomputing the cell of each
+        *  point that passes the distance test, so a point is only ever reported by its own cell.
+        *  limitSq is re-read per point, so accept() may tighten it.
+      */
+      template <typename Fn>
+      inline void visitCell(const Cell& cell, const Vectors::Vector3& center, const float& limitSq, Fn&& accept) const {
+        const uint32_t bucket = bucketOf(cell);
+        for (uint32_t slot = m_cellStart[bucket]; slot < m_cellStart[bucket + 1]; ++slot) {
+          const Vectors::Vector3& p = m_positions[slot];
+          const float dx = p.x - center.x, dy = p.y - center.y, dz = p.z - center.z;
+          const float squareDistance = dx * dx + dy * dy + dz * dz;
+          if (squareDistance > limitSq) {
+            continue;
+          }
+          const Cell own = cellOf(p);
+          if (own.x == cell.x && own.y == cell.y && own.z == cell.z) {
+            accept(slot, squareDistance);
+          }
+        }
+      }
+
+      /*
+        *  @brief k-nearest search into best[0, k), kept sorted with closer(). Cells are visited in
+        *  cubic shells around the center's cell until no unvisited cell can hold anything closer
+        *  than the current k-th neighbor. @return Number of neighbors found.
+      */
+      inline size_t searchNearest(const Vectors::Vector3& center, Neighbor* best, size_t k, float maxRadius) const {
+        if (empty() || k == 0 || maxRadius < 0.0f) {
+          return 0;
+        }
+        size_t count = 0;
+        float limitSq = maxRadius * maxRadius;
+        auto offer = [&](uint32_t slot, float squareDistance) {
+          Neighbor candidate = { m_indices[slot], squareDistance };
+          if (count == k && !closer(candidate, best[k - 1])) {
+            return;
+          }
+          size_t i = count < k ? count++ : k - 1;
+          for (; i > 0 && closer(candidate, best[i - 1]); --i) {
+            best[i] = best[i - 1];
+          }
+          best[i] = candidate;
+          if (count == k) {
+            limitSq = best[k - 1].squareDistance;
+          }
+        };
+
+        const Cell home = clampedCellOf(center);
+        for (int32_t ring = 0;; ++ring) {
+          const Cell lo = { home.x - ring, home.y - ring, home.z - ring };
+          const Cell hi = { home.x + ring, home.y + ring, home.z + ring };
+          const int32_t zLo = std::max(lo.z, m_cellMin.z), zHi = std::min(hi.z, m_cellMax.z);
+          for (int32_t x = std::max(lo.x, m_cellMin.x); x <= std::min(hi.x, m_cellMax.x); ++x) {
+            for (int32_t y = std::max(lo.y, m_cellMin.y); y <= std::min(hi.y, m_cellMax.y); ++y) {
+              if (x == lo.x || x == hi.x || y == lo.y || y == hi.y) {
+                for (int32_t z = zLo; z <= zHi; ++z) {
+                  visitCell({ x, y, z }, center, limitSq, offer);
+                }
+              }
+              else {
+                // Interior columns only gain their two end cells.
+                if (lo.z >= m_cellMin.z && lo.z <= m_cellMax.z) {
+                  visitCell({ x, y, lo.z }, center, limitSq, offer);
+                }
+                if (hi.z >= m_cellMin.z && hi.z <= m_cellMax.z) {
+                  visitCell({ x, y, hi.z }, center, limitSq, offer);
+                }
+              }
+            }
+          }
+
+          // Unvisited cells lie in the slabs of the occupied range beyond each face of the searched
+          // block; nothing there is closer than the nearest such slab.
+          float reachSq = std::numeric_limits<float>::infinity();
+          bool covered = true;
+          for (int axis = 0; axis < 3; ++axis) {
+            for (int side = 0; side < 2; ++side) {
+              Cell slabLo = m_cellMin, slabHi = m_cellMax;
+              int32_t& edge = side == 0 ? component(slabHi, axis) : component(slabLo, axis);
+              edge = side == 0 ? component(lo, axis) - 1 : component(hi, axis) + 1;
+              if (component(slabLo, axis) > component(slabHi, axis)) {
+                continue;
+              }
+              covered = false;
+              reachSq = Math::EMin(reachSq, squareDistanceToCells(center, slabLo, slabHi));
+            }
+          }
+          if (covered || reachSq > maxRadius * maxRadius || (count == k && limitSq <= reachSq)) {
+            return count;
+          }
+        }
+      }
+
+      static inline size_t chunksFor(size_t n) {
+        size_t chunks = (n + PARALLEL_BUILD_THRESHOLD - 1) / PARALLEL_BUILD_THRESHOLD;
+        return std::max<size_t>(1, std::min<size_t>(chunks, Parallel::workerCount()));
+      }
+
+      /*
+        *  @brief Stable LSD radix sort of (keys, values) by key, 8 bits per pass. Each pass counts
+        *  digits per chunk in parallel, turns the counts into per-chunk offsets, then scatters in
+        *  parallel; chunk boundaries are fixed, so the result does not depend on scheduling.
+      */
+      inline void radixSort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, size_t chunkCount,
+                            size_t chunkSize) const {
+        const size_t n = keys.size();
+        std::vector<uint32_t> keysOut(n), valuesOut(n);
+        std::vector<uint32_t> offsets(chunkCount * 256);
+        for (int shift = 0; shift < m_bucketBits; shift += 8) {
+          std::fill(offsets.begin(), offsets.end(), 0u);
+          Parallel::parallelFor(0, chunkCount, 1, [&](size_t cBegin, size_t cEnd) {
+            for (size_t c = cBegin; c < cEnd; ++c) {
+              uint32_t* count = &offsets[c * 256];
+              for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); ++i) {
+                ++count[(keys[i] >> shift) & 0xFF];
+              }
+            }
+          });
+          uint32_t running = 0;
+          for (size_t digit = 0; digit < 256; ++digit) {
+            for (size_t c = 0; c < chunkCount; ++c) {
+              uint32_t count = offsets[c * 256 + digit];
+              offsets[c * 256 + digit] = running;
+              running += count;
+            }
+          }
+          Parallel::parallelFor(0, chunkCount, 1, [&](size_t cBegin, size_t cEnd) {
+            for (size_t c = cBegin; c < cEnd; ++c) {
+              uint32_t* offset = &offsets[c * 256];
+              for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); ++i) {
+                uint32_t slot = offset[(keys[i] >> shift) & 0xFF]++;
+                keysOut[slot] = keys[i];
+                valuesOut[slot] = values[i];
+              }
+            }
+          });
+          keys.swap(keysOut);
+          values.swap(valuesOut);
+        }
+      }
+
+      float m_cellSize;
+      float m_invCellSize;
+      int m_bucketBits = 0;
+      Cell m_cellMin = { 0, 0, 0 };
+      Cell m_cellMax = { -1, -1, -1 };
+      std::vector<Vectors::Vector3> m_positions;
+      std::vector<uint32_t> m_indices;
+      std::vector<uint32_t> m_cellStart = std::vector<uint32_t>(2, 0);
+    };
+
+  }
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+#include "Matriz4x4.h"
+#include <iostream>
+
+namespace EngineUtilities {
+  namespace Transforms {
+
+    /*
+      *  @brief Translation / rotation / scale transform: p' = translation + rotation * (scale * p).
+      *  Composition and inversion work on the TRS parts directly, which is much cheaper than
+      *  multiplying 4x4 matrices. The equivalent Matriz4x4 is built on demand and cached until
+      *  a setter marks it dirty, so static nodes pay for it once.
+      *  Composition and inverse are exact for uniform scale; with non-uniform scale under a
+      *  rotation the result drops the shear, like every TRS representation.
+    */
+    template <typename T>
+    class TTransform {
+    public:
+      using value_type = T;
+      using Vector3 = Vectors::TVector3<T>;
+      using Quaternion = Rotations::TQuaternion<T>;
+      using Matriz4x4 = Matrices::TMatriz4x4<T>;
+
+      /*
+        *  @brief Identity transform.
+      */
+      inline TTransform()
+        : m_translation(0.0f, 0.0f, 0.0f), m_rotation(), m_scale(1.0f, 1.0f, 1.0f), m_matrix(), m_dirty(false) {}
+
+      /*
+        *  @brief Builds a transform from its parts.
+        *  @param translation Translation.
+        *  @param rotation Rotation (expected to be normalized).
+        *  @param scale Per-axis scale.
+      */
+      inline TTransform(const Vector3& translation, const Quaternion& rotation,
+                        const Vector3& scale = Vector3(1.0f, 1.0f, 1.0f))
+        : m_translation(translation), m_rotation(rotation), m_scale(scale), m_matrix(), m_dirty(true) {}
+
+      inline const Vector3& translation() const { return m_translation; }
+      inline const Quaternion& rotation() const { return m_rotation; }
+      inline const Vector3& scale() const { return m_scale; }
+
+      inline void setTranslation(const Vector3& translation) {
+        m_translation = translation;
+        m_dirty = true;
+      }
+
+      inline void setRotation(const Quaternion& rotation) {
+        m_rotation = rotation;
+        m_dirty = true;
+      }
+
+      inline void setScale(const Vector3& scale) {
+        m_scale = scale;
+        m_dirty = true;
+      }
+
+      /*
+        *  @brief Moves the transform by delta (in parent space).
+      */
+      inline void translate(const Vector3& delta) {
+        m_translation += delta;
+        m_dirty = true;
+      }
+
+      /*
+        *  @brief Applies an extra rotation after the current one (in parent space).
+      */
+      inline void rotate(const Quaternion& delta) {
+        m_rotation = delta * m_rotation;
+        m_dirty = true;
+      }
+
+      /*
+        *  @brief True if the cached matrix needs rebuilding.
+      */
+      inline bool isDirty() const { return m_dirty; }
+
+      /*
+        *  @brief Transforms a point (scale, then rotation, then translation).
+      */
+      inline Vector3 transformPoint(const Vector3& p) const {
+        return m_translation + m_rotation * scaled(m_scale, p);
+      }
+
+      /*
+        *  @brief Transforms a direction or offset (no translation).
+      */
+      inline Vector3 transformVector(const Vector3& v) const {
+        return m_rotation * scaled(m_scale, v);
+      }
+
+      /*
+        *  @brief Maps a point from parent space back into this transform's space.
+      */
+      inline Vector3 inverseTransformPoint(const Vector3& p) const {
+        return scaled(reciprocal(m_scale), m_rotation.conjugate() * (p - m_translation));
+      }
+
+      /*
+        *  @brief Composition: (*this * child) applies child first, then this transform.
+        *  @param child Transform expressed in this transform's space.
+        *  @return Child transform expressed in this transform's parent space.
+      */
+      inline TTransform operator*(const TTransform& child) const {
+        return TTransform(transformPoint(child.m_translation),
+                          m_rotation * child.m_rotation,
+                          scaled(m_scale, child.m_scale));
+      }
+
+      inline TTransform& operator*=(const TTransform& child) {
+        *this = *this * child;
+        return *this;
+      }
+
+      /*
+        *  @brief Inverse transform (rotation conjugate, reciprocal scale).
+        *  Zero scale components map to zero instead of infinity.
+      */
+      inline TTransform inverse() const {
+        Quaternion invRotation = m_rotation.conjugate();
+        Vector3 invScale = reciprocal(m_scale);
+        Vector3 invTranslation = scaled(invScale, invRotation * m_translation);
+        return TTransform(Vector3(-invTranslation.x, -invTranslation.y, -invTranslation.z), invRotation, invScale);
+      }
+
+      /*
+        *  @brief Matrix equal to createTranslation(t) * rotation.toMatrix4x4() * createScale(s),
+        *  built by scaling the rotation columns instead of two 4x4 products. Cached until the next setter.
+        *  @return Reference to the cached matrix.
+      */
+      inline const Matriz4x4& toMatrix4x4() const {
+        if (m_dirty) {
+          m_matrix = m_rotation.toMatrix4x4();
+          const T s[3] = { m_scale.x, m_scale.y, m_scale.z };
+          for (int c = 0; c < 3; ++c) {
+            m_matrix.m[c][0] *= s[c];
+            m_matrix.m[c][1] *= s[c];
+            m_matrix.m[c][2] *= s[c];
+          }
+          m_matrix.m[3][0] = m_translation.x;
+          m_matrix.m[3][1] = m_translation.y;
+          m_matrix.m[3][2] = m_translation.z;
+          m_dirty = false;
+        }
+        return m_matrix;
+      }
+
+      /*
+        *  @brief Identity transform.
+      */
+      static inline TTransform Identity() {
+        return TTransform();
+      }
+
+      /*
+        *  @brief Transform that only translates / only rotates / only scales.
+      */
+      static inline TTransform fromTranslation(const Vector3& translation) {
+        return TTransform(translation, Quaternion());
+      }
+
+      static inline TTransform fromRotation(const Quaternion& rotation) {
+        return TTransform(Vector3(0.0f, 0.0f, 0.0f), rotation);
+      }
+
+      static inline TTransform fromScale(const Vector3& scale) {
+        return TTransform(Vector3(0.0f, 0.0f, 0.0f), Quaternion(), scale);
+      }
+
+    private:
+      static inline Vector3 scaled(const Vector3& s, const Vector3& v) {
+        return Vector3(s.x * v.x, s.y * v.y, s.z * v.z);
+      }
+
+      static inline T safeReciprocal(T value) {
+        return Math::abs(value) < Math::Constants<T>::EPSILON ? T(0.0f) : T(1.0f / value);
+      }
+
+      static inline Vector3 reciprocal(const Vector3& s) {
+        return Vector3(safeReciprocal(s.x), safeReciprocal(s.y), safeReciprocal(s.z));
+      }
+
+      Vector3 m_translation;
+      Quaternion m_rotation;
+      Vector3 m_scale;
+      mutable Matriz4x4 m_matrix;
+      mutable bool m_dirty;
+    };
+
+    using Transform = TTransform<float>;
+    using Transformd = TTransform<double>;
+
+    /*
+      *  @brief Output stream operator for Transform.
+    */
+    template <typename T>
+    inline std::ostream& operator<<(std::ostream& os, const TTransform<T>& t) {
+      os << "Transform(T:" << t.translation() << ", R:" << t.rotation() << ", S:" << t.scale() << ")";
+      return os;
+    }
+
+  }
+}
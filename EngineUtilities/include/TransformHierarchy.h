@@ -0,0 +1,234 @@
+#pragma once
+
+#include "EngineParallel.h"
+#include "Transform.h"
+#include "Matriz4x4.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Transforms {
+
+    /*
+      *  @brief Flat transform hierarchy: parent indices, local TRS and world matrices in parallel arrays.
+      *  updateWorld() walks the nodes level by level (all depth-0 nodes, then depth 1, ...), so every
+      *  parent is final before its children read it and the nodes of one level are independent;
+      *  large levels are split across Parallel::parallelFor. Only nodes whose local transform
+      *  changed, or whose ancestor changed, are recomputed: world = world(parent) * local.toMatrix4x4().
+    */
+    class TransformHierarchy {
+    public:
+      /*
+        *  @brief Parent index of root nodes.
+      */
+      static constexpr int32_t NO_PARENT = -1;
+
+      /*
+        *  @brief Level size below which updateWorld stays on the calling thread.
+      */
+      static constexpr size_t LEVEL_PARALLEL_THRESHOLD = 2048;
+
+      inline TransformHierarchy() : m_levelsDirty(false), m_anyDirty(false) {}
+
+      /*
+        *  @brief Number of nodes.
+      */
+      inline size_t size() const { return m_parent.size(); }
+
+      /*
+        *  @brief Reserves room for count nodes.
+      */
+      inline void reserve(size_t count) {
+        m_parent.reserve(count);
+        m_local.reserve(count);
+        m_world.reserve(count);
+        m_dirty.reserve(count);
+        m_depth.reserve(count);
+      }
+
+      /*
+        *  @brief Appends a node.
+        *  @param local Transform relative to the parent.
+        *  @param parent Index of an existing node, or NO_PARENT for a root. Invalid indices make a root.
+        *  @return Index of the new node.
+      */
+      inline int32_t addNode(const Transform& local, int32_t parent = NO_PARENT) {
+        int32_t index = static_cast<int32_t>(m_parent.size());
+        if (parent < 0 || parent >= index) {
+          parent = NO_PARENT;
+        }
+        m_parent.push_back(parent);
+        m_local.push_back(local);
+        m_world.push_back(Matrices::Matriz4x4());
+        m_dirty.push_back(1);
+        m_depth.push_back(parent == NO_PARENT ? 0 : m_depth[parent] + 1);
+        m_levelsDirty = true;
+        m_anyDirty = true;
+        return index;
+      }
+
+      /*
+        *  @brief Moves a node (and its subtree) under a new parent.
+        *  @param node Node to move.
+        *  @param parent New parent, or NO_PARENT to make it a root.
+        *  @return False (and nothing changes) if an index is invalid or parent lies in node's subtree.
+      */
+      inline bool setParent(int32_t node, int32_t parent) {
+        int32_t count = static_cast<int32_t>(m_parent.size());
+        if (node < 0 || node >= count || parent >= count || parent < NO_PARENT) {
+          return false;
+        }
+        for (int32_t p = parent; p != NO_PARENT; p = m_parent[p]) {
+          if (p == node) {
+            return false;
+          }
+        }
+        m_parent[node] = parent;
+        m_dirty[node] = 1;
+        m_levelsDirty = true;
+        m_anyDirty = true;
+        return true;
+      }
+
+      inline int32_t parent(int32_t node) const { return m_parent[node]; }
+
+      inline const Transform& local(int32_t node) const { return m_local[node]; }
+
+      /*
+        *  @brief Replaces a node's local transform; it and its subtree are recomputed on the next update.
+      */
+      inline void setLocal(int32_t node, const Transform& local) {
+        m_local[node] = local;
+        m_dirty[node] = 1;
+        m_anyDirty = true;
+      }
+
+      /*
+        *  @brief World matrix of a node as of the last updateWorld().
+      */
+      inline const Matrices::Matriz4x4& world(int32_t node) const { return m_world[node]; }
+
+      /*
+        *  @brief All world matrices, indexed like the nodes.
+      */
+      inline const std::vector<Matrices::Matriz4x4>& worldMatrices() const { return m_world; }
+
+      /*
+        *  @brief Number of depth levels (0 for an empty hierarchy).
+      */
+      inline size_t levelCount() {
+        rebuildLevels();
+        return m_levelStart.empty() ? 0 : m_levelStart.size() - 1;
+      }
+
+      /*
+        *  @brief Recomputes the world matrices of dirty nodes and their descendants.
+        *  @return Number of nodes recomputed.
+      */
+      inline size_t updateWorld() {
+        if (!m_anyDirty) {
+          return 0;
+        }
+        rebuildLevels();
+        size_t levels = m_levelStart.size() - 1;
+        size_t updated = 0;
+        for (size_t level = 0; level < levels; ++level) {
+          size_t begin = m_levelStart[level];
+          size_t end = m_levelStart[level + 1];
+          Parallel::parallelFor(begin, end, LEVEL_PARALLEL_THRESHOLD, [this](size_t first, size_t last) {
+            updateRange(first, last);
+          });
+        }
+        for (size_t i = 0; i < m_changed.size(); ++i) {
+          updated += m_changed[i];
+        }
+        std::fill(m_dirty.begin(), m_dirty.end(), static_cast<unsigned char>(0));
+        m_anyDirty = false;
+        return updated;
+      }
+
+    private:
+      /*
+        *  @brief Updates m_order[first, last), all on the same level.
+        *  m_changed is indexed by node, so children on the next level can read their parent's flag.
+      */
+      inline void updateRange(size_t first, size_t last) {
+        for (size_t k = first; k < last; ++k) {
+          int32_t node = m_order[k];
+          int32_t parent = m_parent[node];
+          bool changed = m_dirty[node] || (parent != NO_PARENT && m_changed[parent]);
+          m_changed[node] = changed ? 1 : 0;
+          if (!changed) {
+            continue;
+          }
+          const Matrices::Matriz4x4& localMatrix = m_local[node].toMatrix4x4();
+          if (parent == NO_PARENT) {
+            m_world[node] = localMatrix;
+          }
+          else {
+            Matrices::Matriz4x4::multiply(m_world[parent], localMatrix, m_world[node]);
+          }
+        }
+      }
+
+      /*
+        *  @brief Recomputes depths after topology changes and buckets the nodes by depth (counting sort).
+      */
+      inline void rebuildLevels() {
+        size_t count = m_parent.size();
+        m_changed.resize(count);
+        if (!m_levelsDirty && m_levelStart.size() >= 1) {
+          return;
+        }
+
+        // Depths via the parent chain; setParent may have moved a node below a later index.
+        std::vector<int32_t> stack;
+        std::fill(m_depth.begin(), m_depth.end(), -1);
+        int32_t maxDepth = -1;
+        for (size_t i = 0; i < count; ++i) {
+          int32_t node = static_cast<int32_t>(i);
+          while (node != NO_PARENT && m_depth[node] < 0) {
+            stack.push_back(node);
+            node = m_parent[node];
+          }
+          int32_t depth = node == NO_PARENT ? -1 : m_depth[node];
+          while (!stack.empty()) {
+            m_depth[stack.back()] = ++depth;
+            stack.pop_back();
+          }
+          if (m_depth[i] > maxDepth) {
+            maxDepth = m_depth[i];
+          }
+        }
+
+        m_levelStart.assign(static_cast<size_t>(maxDepth + 2), 0);
+        for (size_t i = 0; i < count; ++i) {
+          ++m_levelStart[m_depth[i] + 1];
+        }
+        for (size_t level = 1; level < m_levelStart.size(); ++level) {
+          m_levelStart[level] += m_levelStart[level - 1];
+        }
+        m_order.resize(count);
+        std::vector<size_t> cursor(m_levelStart.begin(), m_levelStart.end() - 1);
+        for (size_t i = 0; i < count; ++i) {
+          m_order[cursor[m_depth[i]]++] = static_cast<int32_t>(i);
+        }
+        m_levelsDirty = false;
+      }
+
+      std::vector<int32_t> m_parent;
+      std::vector<Transform> m_local;
+      std::vector<Matrices::Matriz4x4> m_world;
+      std::vector<unsigned char> m_dirty;
+      std::vector<unsigned char> m_changed;
+      std::vector<int32_t> m_depth;
+      std::vector<int32_t> m_order;
+      std::vector<size_t> m_levelStart;
+      bool m_levelsDirty;
+      bool m_anyDirty;
+    };
+
+  }
+}
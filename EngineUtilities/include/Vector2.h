@@ -2,6 +2,9 @@
 #pragma once
 #include "EngineMath.h"
 #include "EngineMath.h" // La ruta de inclusin ahora es relativa a la carpeta raz de EngineUtilities
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
 
 namespace EngineUtilities {
 namespace Vectors {
@@ -17,27 +20,14 @@ namespace Vectors {
         /**
          * @brief Constructor por defecto. Inicializa el vector a (0.0f, 0.0f).
          */
-        inline Vector2() : x(0.0f), y(0.0f) {}
+        constexpr Vector2() : x(0.0f), y(0.0f) {}
 
         /**
          * @brief Constructor que inicializa el vector con valores especficos.
          * @param inX El valor inicial para el componente X.
          * @param inY El valor inicial para el componente Y.
          */
-        inline Vector2(float inX, float inY) : x(inX), y(inY) {}
-
-        // --- Operadores de Asignacin ---
-
-        /**
-         * @brief Operador de asignacin por copia.
-         * @param other El vector 2D a copiar.
-         * @return Una referencia a este vector despus de la asignacin.
-         */
-        inline Vector2& operator=(const Vector2& other) {
-            x = other.x;
-            y = other.y;
-            return *this;
-        }
+        constexpr Vector2(float inX, float inY) : x(inX), y(inY) {}
 
         // --- Operadores Aritmticos (Vector + Vector) ---
 
@@ -46,7 +36,7 @@ namespace Vectors {
          * @param other El vector a sumar.
          * @return Un nuevo vector 2D que es la suma de ambos.
          */
-        inline Vector2 operator+(const Vector2& other) const {
+        constexpr Vector2 operator+(const Vector2& other) const {
             return Vector2(x + other.x, y + other.y);
         }
 
@@ -55,7 +45,7 @@ namespace Vectors {
          * @param other El vector a restar.
          * @return Un nuevo vector 2D que es la resta de ambos.
          */
-        inline Vector2 operator-(const Vector2& other) const {
+        constexpr Vector2 operator-(const Vector2& other) const {
             return Vector2(x - other.x, y - other.y);
         }
 
@@ -66,7 +56,7 @@ namespace Vectors {
          * @param scalar El valor escalar por el que multiplicar.
          * @return Un nuevo vector 2D escalado.
          */
-        inline Vector2 operator*(float scalar) const {
+        constexpr Vector2 operator*(float scalar) const {
             return Vector2(x * scalar, y * scalar);
         }
 
@@ -75,7 +65,7 @@ namespace Vectors {
          * @param scalar El valor escalar por el que dividir.
          * @return Un nuevo vector 2D escalado.
          */
-        inline Vector2 operator/(float scalar) const {
+        constexpr Vector2 operator/(float scalar) const {
             // Considerar manejo de divisin por cero si 'scalar' puede ser 0
             if (scalar != 0.0f) {
                 return Vector2(x / scalar, y / scalar);
@@ -90,7 +80,7 @@ namespace Vectors {
          * @param other El vector a sumar.
          * @return Una referencia a este vector despus de la operacin.
          */
-        inline Vector2& operator+=(const Vector2& other) {
+        constexpr Vector2& operator+=(const Vector2& other) {
             x += other.x;
             y += other.y;
             return *this;
@@ -101,7 +91,7 @@ namespace Vectors {
          * @param other El vector a restar.
          * @return Una referencia a este vector despus de la operacin.
          */
-        inline Vector2& operator-=(const Vector2& other) {
+        constexpr Vector2& operator-=(const Vector2& other) {
             x -= other.x;
             y -= other.y;
             return *this;
@@ -112,7 +102,7 @@ namespace Vectors {
          * @param scalar El valor escalar por el que multiplicar.
          * @return Una referencia a este vector despus de la operacin.
          */
-        inline Vector2& operator*=(float scalar) {
+        constexpr Vector2& operator*=(float scalar) {
             x *= scalar;
             y *= scalar;
             return *this;
@@ -123,7 +113,7 @@ namespace Vectors {
          * @param scalar El valor escalar por el que dividir.
          * @return Una referencia a este vector despus de la operacin.
          */
-        inline Vector2& operator/=(float scalar) {
+        constexpr Vector2& operator/=(float scalar) {
             if (scalar != 0.0f) {
                 x /= scalar;
                 y /= scalar;
@@ -138,7 +128,7 @@ namespace Vectors {
          * @param other El vector a comparar.
          * @return True si los vectores son aproximadamente iguales, false en caso contrario.
          */
-        inline bool operator==(const Vector2& other) const {
+        constexpr bool operator==(const Vector2& other) const {
             return Math::approxEqual(x, other.x) && Math::approxEqual(y, other.y);
         }
 
@@ -147,7 +137,7 @@ namespace Vectors {
          * @param other El vector a comparar.
          * @return True si los vectores son diferentes, false en caso contrario.
          */
-        inline bool operator!=(const Vector2& other) const {
+        constexpr bool operator!=(const Vector2& other) const {
             return !(*this == other);
         }
 
@@ -158,7 +148,7 @@ namespace Vectors {
          * @param other El otro vector 2D.
          * @return El resultado escalar del producto punto.
          */
-        inline float dot(const Vector2& other) const {
+        constexpr float dot(const Vector2& other) const {
             return x * other.x + y * other.y;
         }
 
@@ -166,7 +156,7 @@ namespace Vectors {
          * @brief Calcula la magnitud (longitud) de este vector.
          * @return La magnitud del vector.
          */
-        inline float magnitude() const {
+        constexpr float magnitude() const {
             return Math::sqrt(x * x + y * y);
         }
 
@@ -175,7 +165,7 @@ namespace Vectors {
          * Es ms rpido que magnitude() ya que evita la operacin de raz cuadrada.
          * @return La magnitud al cuadrado del vector.
          */
-        inline float squareMagnitude() const {
+        constexpr float squareMagnitude() const {
             return x * x + y * y;
         }
 
@@ -184,11 +174,12 @@ namespace Vectors {
          * Modifica el vector actual.
          * @return Una referencia a este vector normalizado.
          */
-        inline Vector2& normalize() {
-            float mag = magnitude();
-            if (mag > Math::EPSILON) { // Evitar divisin por cero o por un nmero muy pequeo
-                x /= mag;
-                y /= mag;
+        constexpr Vector2& normalize() {
+            float sqMag = squareMagnitude();
+            if (sqMag > Math::EPSILON * Math::EPSILON) { // Evitar divisin por cero o por un nmero muy pequeo
+                float invMag = Math::rsqrt(sqMag);
+                x *= invMag;
+                y *= invMag;
             }
             return *this;
         }
@@ -197,10 +188,11 @@ namespace Vectors {
          * @brief Retorna un vector unitario en la misma direccin que este vector, sin modificar el original.
          * @return Un nuevo vector 2D normalizado.
          */
-        inline Vector2 normalized() const {
-            float mag = magnitude();
-            if (mag > Math::EPSILON) {
-                return Vector2(x / mag, y / mag);
+        constexpr Vector2 normalized() const {
+            float sqMag = squareMagnitude();
+            if (sqMag > Math::EPSILON * Math::EPSILON) {
+                float invMag = Math::rsqrt(sqMag);
+                return Vector2(x * invMag, y * invMag);
             }
             return Vector2(); // Retorna un vector nulo si la magnitud es cero o muy pequea
         }
@@ -210,7 +202,7 @@ namespace Vectors {
          * @param other El otro vector 2D (punto).
          * @return La distancia euclidiana entre los dos puntos.
          */
-        inline float distance(const Vector2& other) const {
+        constexpr float distance(const Vector2& other) const {
             float dx = x - other.x;
             float dy = y - other.y;
             return Math::sqrt(dx * dx + dy * dy);
@@ -222,13 +214,56 @@ namespace Vectors {
          * @param other El otro vector 2D (punto).
          * @return La distancia al cuadrado entre los dos puntos.
          */
-        inline float squareDistance(const Vector2& other) const {
+        constexpr float squareDistance(const Vector2& other) const {
             float dx = x - other.x;
             float dy = y - other.y;
             return dx * dx + dy * dy;
         }
+
+        /**
+         * @brief Comprueba si la distancia a otro punto es menor que un radio, sin raz cuadrada.
+         * @param other El otro vector 2D (punto).
+         * @param radius El radio (no negativo).
+         * @return true si la distancia es menor que radius.
+         */
+        constexpr bool distanceLessThan(const Vector2& other, float radius) const {
+            return squareDistance(other) < radius * radius;
+        }
+
+        /**
+         * @brief Busca el punto ms cercano a este entre count puntos (en empate, el de menor ndice).
+         * Ver nearestOfBatch (VectorBatch.h) para la versin SIMD.
+         * @param points Los puntos a recorrer.
+         * @param count El nmero de puntos.
+         * @param outSquareDistance Opcional: recibe la distancia al cuadrado al punto devuelto.
+         * @return El ndice del punto ms cercano, o count si count es 0.
+         */
+        constexpr size_t nearestOf(const Vector2* points, size_t count, float* outSquareDistance = nullptr) const {
+            if (count == 0) {
+                return count;
+            }
+            size_t best = 0;
+            float bestSq = squareDistance(points[0]);
+            for (size_t i = 1; i < count; ++i) {
+                float sq = squareDistance(points[i]);
+                if (sq < bestSq) {
+                    bestSq = sq;
+                    best = i;
+                }
+            }
+            if (outSquareDistance) {
+                *outSquareDistance = bestSq;
+            }
+            return best;
+        }
     };
 
+    static_assert(std::is_trivially_copyable<Vector2>::value, "Vector2 must be trivially copyable");
+    static_assert(std::is_standard_layout<Vector2>::value, "Vector2 must be standard layout");
+    static_assert(sizeof(Vector2) == 2 * sizeof(float), "Vector2 must stay two packed floats");
+    static_assert(alignof(Vector2) == alignof(float), "Vector2 must keep float alignment");
+    static_assert(offsetof(Vector2, y) == sizeof(float), "Vector2 components must be laid out as x, y");
+
     // --- Sobrecarga de operador de multiplicacin escalar para permitir escalar * Vector2 ---
     /**
      * @brief Multiplica un escalar por un vector 2D.
@@ -236,7 +271,7 @@ namespace Vectors {
      * @param vec El vector 2D.
      * @return Un nuevo vector 2D escalado.
      */
-  inline Vector2 operator*(float scalar, const Vector2& vec) {
+  constexpr Vector2 operator*(float scalar, const Vector2& vec) {
    return Vector2(vec.x * scalar, vec.y * scalar);
     }
   inline std::ostream& operator<<(std::ostream& os, const Vector2& v) {
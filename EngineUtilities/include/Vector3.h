@@ -1,17 +1,30 @@
 #pragma once
 
 #include "EngineMath.h"
+#include "EngineHalf.h"
+#include <cstddef>
 #include <iostream> 
+#include <type_traits>
 
 namespace EngineUtilities {
   namespace Vectors {
 
 
-    struct Vector3 {
+    /*
+      *  @brief 3D vector templated over its scalar type.
+      *  Use the Vector3 (float), Vector3d (double) and Vector3h (half storage) aliases.
+    */
+    template <typename T>
+    struct TVector3 {
+      /*
+        *  @brief Scalar type of the components.
+      */
+      using value_type = T;
+
       /*
         *  @brief X component of the vector
       */
-      float x, 
+      T x, 
       /*
         *  @brief Y component of the vector
       */
@@ -24,7 +37,7 @@ namespace EngineUtilities {
       /*
         *  @brief Default constructor. Initializes all components to zero.
       */
-      inline Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
+      constexpr TVector3() : x(0.0f), y(0.0f), z(0.0f) {}
 
       /*
         *  @brief Constructor with custom values for each component.
@@ -32,26 +45,14 @@ namespace EngineUtilities {
         *  @param inY Y component
         *  @param inZ Z component
       */
-      inline Vector3(float inX, float inY, float inZ) : x(inX), y(inY), z(inZ) {}
-
-      /*
-        *  @brief Assignment operator.
-        *  @param other Vector to copy from
-        *  @return Reference to this vector
-      */
-      inline Vector3& operator=(const Vector3& other) {
-        x = other.x;
-        y = other.y;
-        z = other.z;
-        return *this;
-      }
+      constexpr TVector3(T inX, T inY, T inZ) : x(inX), y(inY), z(inZ) {}
 
       /*
         *  @brief Equality operator.
         *  @param other Vector to compare
         *  @return True if all components are approximately equal
       */
-      inline bool operator==(const Vector3& other) const {
+      constexpr bool operator==(const TVector3& other) const {
         return Math::approxEqual(x, other.x) && Math::approxEqual(y, other.y) && Math::approxEqual(z, other.z);
       }
 
@@ -60,7 +61,7 @@ namespace EngineUtilities {
         *  @param other Vector to compare
         *  @return True if any component is not approximately equal
       */
-      inline bool operator!=(const Vector3& other) const {
+      constexpr bool operator!=(const TVector3& other) const {
         return !(*this == other);
       }
 
@@ -69,8 +70,8 @@ namespace EngineUtilities {
         *  @param other Vector to add
         *  @return Resulting vector
       */
-      Vector3 operator+(const Vector3& other) const {
-        return Vector3(x + other.x, y + other.y, z + other.z);
+      constexpr TVector3 operator+(const TVector3& other) const {
+        return TVector3(x + other.x, y + other.y, z + other.z);
       }
 
       /*
@@ -78,8 +79,8 @@ namespace EngineUtilities {
         *  @param other Vector to subtract
         *  @return Resulting vector
       */
-      inline Vector3 operator-(const Vector3& other) const {
-        return Vector3(x - other.x, y - other.y, z - other.z);
+      constexpr TVector3 operator-(const TVector3& other) const {
+        return TVector3(x - other.x, y - other.y, z - other.z);
       }
 
       /*
@@ -87,8 +88,8 @@ namespace EngineUtilities {
         *  @param scalar Value to multiply
         *  @return Resulting vector
       */
-      inline Vector3 operator*(float scalar) const {
-        return Vector3(x * scalar, y * scalar, z * scalar);
+      constexpr TVector3 operator*(T scalar) const {
+        return TVector3(x * scalar, y * scalar, z * scalar);
       }
 
       /*
@@ -96,11 +97,11 @@ namespace EngineUtilities {
         *  @param scalar Value to divide
         *  @return Resulting vector, or zero vector if scalar is near zero
       */
-      inline Vector3 operator/(float scalar) const {
-        if (Math::abs(scalar) < Math::EPSILON) {
-          return Vector3(0.0f, 0.0f, 0.0f); 
+      constexpr TVector3 operator/(T scalar) const {
+        if (Math::abs(scalar) < Math::Constants<T>::EPSILON) {
+          return TVector3(0.0f, 0.0f, 0.0f); 
         }
-        return Vector3(x / scalar, y / scalar, z / scalar);
+        return TVector3(x / scalar, y / scalar, z / scalar);
       }
 
       /*
@@ -108,7 +109,7 @@ namespace EngineUtilities {
         *  @param other Vector to add
         *  @return Reference to this vector
       */
-      inline Vector3& operator+=(const Vector3& other) {
+      constexpr TVector3& operator+=(const TVector3& other) {
         x += other.x;
         y += other.y;
         z += other.z;
@@ -120,7 +121,7 @@ namespace EngineUtilities {
         *  @param other Vector to subtract
         *  @return Reference to this vector
       */
-      inline Vector3& operator-=(const Vector3& other) {
+      constexpr TVector3& operator-=(const TVector3& other) {
         x -= other.x;
         y -= other.y;
         z -= other.z;
@@ -132,7 +133,7 @@ namespace EngineUtilities {
         *  @param scalar Value to multiply
         *  @return Reference to this vector
       */
-      inline Vector3& operator*=(float scalar) {
+      constexpr TVector3& operator*=(T scalar) {
         x *= scalar;
         y *= scalar;
         z *= scalar;
@@ -144,8 +145,8 @@ namespace EngineUtilities {
         *  @param scalar Value to divide
         *  @return Reference to this vector, or zero vector if scalar is near zero
       */
-      inline Vector3& operator/=(float scalar) {
-        if (Math::abs(scalar) < Math::EPSILON) {
+      constexpr TVector3& operator/=(T scalar) {
+        if (Math::abs(scalar) < Math::Constants<T>::EPSILON) {
           x = y = z = 0.0f;
         }
         else {
@@ -161,7 +162,7 @@ namespace EngineUtilities {
         *  @param other Vector to dot with
         *  @return Scalar dot product
       */
-      inline float dot(const Vector3& other) const {
+      constexpr T dot(const TVector3& other) const {
         return x * other.x + y * other.y + z * other.z;
       }
 
@@ -170,8 +171,8 @@ namespace EngineUtilities {
         *  @param other Vector to cross with
         *  @return Resulting vector
       */
-      inline Vector3 cross(const Vector3& other) const {
-        return Vector3(
+      constexpr TVector3 cross(const TVector3& other) const {
+        return TVector3(
           y * other.z - z * other.y,
           z * other.x - x * other.z,
           x * other.y - y * other.x
@@ -180,17 +181,17 @@ namespace EngineUtilities {
 
       /*
         *  @brief Magnitude (length) of the vector.
-        *  @return Magnitude as a float
+        *  @return Magnitude as a T
       */
-      inline float magnitude() const {
+      constexpr T magnitude() const {
         return Math::sqrt(x * x + y * y + z * z);
       }
 
       /*
         *  @brief Squared magnitude of the vector.
-        *  @return Squared magnitude as a float
+        *  @return Squared magnitude as a T
       */
-      inline float squareMagnitude() const {
+      constexpr T squareMagnitude() const {
         return x * x + y * y + z * z;
       }
 
@@ -198,12 +199,13 @@ namespace EngineUtilities {
         *  @brief Normalizes the vector in place.
         *  @return Reference to this vector
       */
-      inline Vector3& normalize() {
-        float mag = magnitude();
-        if (mag > Math::EPSILON) {
-          x /= mag;
-          y /= mag;
-          z /= mag;
+      constexpr TVector3& normalize() {
+        T sqMag = squareMagnitude();
+        if (sqMag > Math::Constants<T>::EPSILON * Math::Constants<T>::EPSILON) {
+          T invMag = Math::rsqrt(sqMag);
+          x *= invMag;
+          y *= invMag;
+          z *= invMag;
         }
         else {
           x = y = z = 0.0f; 
@@ -215,8 +217,8 @@ namespace EngineUtilities {
         *  @brief Returns a normalized copy of the vector.
         *  @return Normalized vector
       */
-      inline Vector3 normalized() const {
-        Vector3 result = *this;
+      constexpr TVector3 normalized() const {
+        TVector3 result = *this;
         result.normalize();
         return result;
       }
@@ -224,52 +226,126 @@ namespace EngineUtilities {
       /*
         *  @brief Distance to another vector.
         *  @param other Vector to measure distance to
-        *  @return Distance as a float
+        *  @return Distance as a T
+      */
+      constexpr T distance(const TVector3& other) const {
+        return Math::sqrt(squareDistance(other));
+      }
+
+      /*
+        *  @brief Squared distance to another vector; no square root, so prefer it for comparisons.
+        *  @param other Vector to measure squared distance to
+        *  @return Squared distance as a T
+      */
+      constexpr T squareDistance(const TVector3& other) const {
+        return (*this - other).squareMagnitude();
+      }
+
+      /*
+        *  @brief Range check without a square root.
+        *  @param other Vector to measure distance to
+        *  @param radius Non-negative range
+        *  @return True if the distance to other is less than radius
       */
-      inline float distance(const Vector3& other) const {
-        return (*this - other).magnitude();
+      constexpr bool distanceLessThan(const TVector3& other, T radius) const {
+        return squareDistance(other) < radius * radius;
+      }
+
+      /*
+        *  @brief Closest of count points to this one (ties go to the lower index).
+        *  See nearestOfBatch (VectorBatch.h) for the SIMD version over float arrays.
+        *  @param points Points to search
+        *  @param count Number of points
+        *  @param outSquareDistance Optional output squared distance to the returned point
+        *  @return Index of the closest point, or count if count is 0
+      */
+      constexpr size_t nearestOf(const TVector3* points, size_t count, T* outSquareDistance = nullptr) const {
+        if (count == 0) {
+          return count;
+        }
+        size_t best = 0;
+        T bestSq = squareDistance(points[0]);
+        for (size_t i = 1; i < count; ++i) {
+          T sq = squareDistance(points[i]);
+          if (sq < bestSq) {
+            bestSq = sq;
+            best = i;
+          }
+        }
+        if (outSquareDistance) {
+          *outSquareDistance = bestSq;
+        }
+        return best;
       }
 
       /*
         *  @brief Returns a zero vector.
         *  @return Zero vector
       */
-      static inline Vector3 Zero() {
-        return Vector3(0.0f, 0.0f, 0.0f);
+      static constexpr TVector3 Zero() {
+        return TVector3(0.0f, 0.0f, 0.0f);
       }
 
       /*
         *  @brief Returns a unit vector along the X axis.
         *  @return Unit X vector
       */
-      static inline Vector3 UnitX() {
-        return Vector3(1.0f, 0.0f, 0.0f);
+      static constexpr TVector3 UnitX() {
+        return TVector3(1.0f, 0.0f, 0.0f);
       }
 
       /*
         *  @brief Returns a unit vector along the Y axis.
         *  @return Unit Y vector
       */
-      static inline Vector3 UnitY() {
-        return Vector3(0.0f, 1.0f, 0.0f);
+      static constexpr TVector3 UnitY() {
+        return TVector3(0.0f, 1.0f, 0.0f);
       }
 
       /*
         *  @brief Returns a unit vector along the Z axis.
         *  @return Unit Z vector
       */
-      static inline Vector3 UnitZ() {
-        return Vector3(0.0f, 0.0f, 1.0f);
+      static constexpr TVector3 UnitZ() {
+        return TVector3(0.0f, 0.0f, 1.0f);
       }
     };
 
+    using Vector3 = TVector3<float>;
+    using Vector3d = TVector3<double>;
+    using Vector3h = TVector3<Math::half>;
+
+    /*
+      *  @brief Layout guarantees relied on by memcpy / mmap / network paths and the flat
+      *  component access in VectorExpr.h: trivially copyable, standard layout, x y z packed.
+    */
+    static_assert(std::is_trivially_copyable<Vector3>::value, "Vector3 must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector3d>::value, "Vector3d must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector3h>::value, "Vector3h must be trivially copyable");
+    static_assert(std::is_standard_layout<Vector3>::value, "Vector3 must be standard layout");
+    static_assert(std::is_standard_layout<Vector3d>::value, "Vector3d must be standard layout");
+    static_assert(std::is_standard_layout<Vector3h>::value, "Vector3h must be standard layout");
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must stay three packed floats");
+    static_assert(sizeof(Vector3d) == 3 * sizeof(double), "Vector3d must stay three packed doubles");
+    static_assert(sizeof(Vector3h) == 3 * sizeof(Math::half), "Vector3h must stay three packed halves");
+    static_assert(alignof(Vector3) == alignof(float), "Vector3 must keep float alignment");
+    static_assert(offsetof(Vector3, y) == sizeof(float) && offsetof(Vector3, z) == 2 * sizeof(float),
+                  "Vector3 components must be laid out as x, y, z");
+
+    /*
+      *  @brief Compile-time tables rely on the arithmetic operators staying constexpr.
+    */
+    static_assert(Vector3(1.0f, 2.0f, 3.0f) + Vector3(4.0f, 5.0f, 6.0f) - Vector3(1.0f, 1.0f, 1.0f)
+                  == Vector3(4.0f, 6.0f, 8.0f), "Vector3 arithmetic must stay constexpr");
+
     /*
       *  @brief Scalar multiplication operator (scalar * vector).
       *  @param scalar Value to multiply
       *  @param v Vector to multiply
       *  @return Resulting vector
     */
-    inline Vector3 operator*(float scalar, const Vector3& v) {
+    template <typename T>
+    constexpr TVector3<T> operator*(typename TVector3<T>::value_type scalar, const TVector3<T>& v) {
       return v * scalar;
     }
 
@@ -279,7 +355,8 @@ namespace EngineUtilities {
       *  @param v Vector to output
       *  @return Output stream
     */
-    inline std::ostream& operator<<(std::ostream& os, const Vector3& v) {
+    template <typename T>
+    inline std::ostream& operator<<(std::ostream& os, const TVector3<T>& v) {
       os << "(" << v.x << ", " << v.y << ", " << v.z << ")";
       return os;
     }
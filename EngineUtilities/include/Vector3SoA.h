@@ -0,0 +1,443 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineSIMD.h"
+#include "Vector3.h"
+#include <cstddef>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Vectors {
+
+    /*
+      *  @brief Structure-of-Arrays stream of 3D vectors.
+      *  Components live in three separate 32-byte aligned arrays padded with zeros to a multiple
+      *  of 8, so bulk operations run 8 (AVX2) or 4 (SSE2) lanes at a time without a scalar tail.
+    */
+    class Vector3SoA {
+    public:
+      /*
+        *  @brief Aligned float storage used for each component stream.
+      */
+      using Stream = std::vector<float, SIMD::AlignedAllocator<float>>;
+
+      /*
+        *  @brief Number of lanes every stream is padded to.
+      */
+      static constexpr size_t LANE_PADDING = 8;
+
+      /*
+        *  @brief Default constructor. Creates an empty stream.
+      */
+      inline Vector3SoA() : m_size(0) {}
+
+      /*
+        *  @brief Creates a stream of count zero vectors.
+        *  @param count Number of vectors
+      */
+      inline explicit Vector3SoA(size_t count) : m_size(0) {
+        resize(count);
+      }
+
+      /*
+        *  @brief Creates a stream from an array of Vector3.
+        *  @param vectors Source vectors
+      */
+      inline explicit Vector3SoA(const std::vector<Vector3>& vectors) : m_size(0) {
+        fromAoS(vectors);
+      }
+
+      /*
+        *  @brief Number of vectors in the stream.
+      */
+      inline size_t size() const { return m_size; }
+
+      /*
+        *  @brief True if the stream has no vectors.
+      */
+      inline bool empty() const { return m_size == 0; }
+
+      /*
+        *  @brief Resizes the stream. New vectors are zero.
+        *  @param count New number of vectors
+      */
+      inline void resize(size_t count) {
+        size_t padded = paddedCount(count);
+        m_x.resize(padded, 0.0f);
+        m_y.resize(padded, 0.0f);
+        m_z.resize(padded, 0.0f);
+        for (size_t i = count; i < m_size && i < padded; ++i) {
+          m_x[i] = m_y[i] = m_z[i] = 0.0f;
+        }
+        m_size = count;
+      }
+
+      /*
+        *  @brief Reserves room for count vectors without changing the size.
+        *  @param count Number of vectors
+      */
+      inline void reserve(size_t count) {
+        size_t padded = paddedCount(count);
+        m_x.reserve(padded);
+        m_y.reserve(padded);
+        m_z.reserve(padded);
+      }
+
+      /*
+        *  @brief Removes all vectors.
+      */
+      inline void clear() {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        m_size = 0;
+      }
+
+      /*
+        *  @brief Appends a vector to the end of the stream.
+        *  @param v Vector to append
+      */
+      inline void push_back(const Vector3& v) {
+        if (m_size == m_x.size()) {
+          m_x.resize(m_size + LANE_PADDING, 0.0f);
+          m_y.resize(m_size + LANE_PADDING, 0.0f);
+          m_z.resize(m_size + LANE_PADDING, 0.0f);
+        }
+        set(m_size++, v);
+      }
+
+      /*
+        *  @brief Returns the vector at index i.
+      */
+      inline Vector3 get(size_t i) const {
+        return Vector3(m_x[i], m_y[i], m_z[i]);
+      }
+
+      /*
+        *  @brief Overwrites the vector at index i.
+      */
+      inline void set(size_t i, const Vector3& v) {
+        m_x[i] = v.x;
+        m_y[i] = v.y;
+        m_z[i] = v.z;
+      }
+
+      /*
+        *  @brief Raw access to the component streams (size() valid entries, aligned).
+      */
+      inline float* x() { return m_x.data(); }
+      inline float* y() { return m_y.data(); }
+      inline float* z() { return m_z.data(); }
+      inline const float* x() const { return m_x.data(); }
+      inline const float* y() const { return m_y.data(); }
+      inline const float* z() const { return m_z.data(); }
+
+      /*
+        *  @brief Replaces the contents with an array of Vector3.
+        *  @param vectors Source vectors
+      */
+      inline void fromAoS(const std::vector<Vector3>& vectors) {
+        clear();
+        resize(vectors.size());
+        for (size_t i = 0; i < m_size; ++i) {
+          set(i, vectors[i]);
+        }
+      }
+
+      /*
+        *  @brief Converts the stream back to an array of Vector3.
+        *  @return Vectors in stream order
+      */
+      inline std::vector<Vector3> toAoS() const {
+        std::vector<Vector3> result(m_size);
+        for (size_t i = 0; i < m_size; ++i) {
+          result[i] = get(i);
+        }
+        return result;
+      }
+
+      /*
+        *  @brief Adds other[i] to every vector. Both streams must have the same size.
+        *  @param other Stream to add
+        *  @return Reference to this stream
+      */
+      inline Vector3SoA& add(const Vector3SoA& other) {
+        size_t n = m_x.size();
+        addStream(m_x.data(), other.m_x.data(), n);
+        addStream(m_y.data(), other.m_y.data(), n);
+        addStream(m_z.data(), other.m_z.data(), n);
+        return *this;
+      }
+
+      /*
+        *  @brief Multiplies every vector by a scalar.
+        *  @param scalar Value to multiply
+        *  @return Reference to this stream
+      */
+      inline Vector3SoA& scale(float scalar) {
+        size_t n = m_x.size();
+        scaleStream(m_x.data(), scalar, n);
+        scaleStream(m_y.data(), scalar, n);
+        scaleStream(m_z.data(), scalar, n);
+        return *this;
+      }
+
+      /*
+        *  @brief Writes out[i] = this[i].dot(other[i]).
+        *  @param other Stream to dot with
+        *  @param out Output array of size() floats
+      */
+      inline void dot(const Vector3SoA& other, float* out) const {
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = dotAVX2(other, out);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        for (; i + 4 <= m_size; i += 4) {
+          __m128 d = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(_mm_load_ps(&m_x[i]), _mm_load_ps(&other.m_x[i])),
+            _mm_mul_ps(_mm_load_ps(&m_y[i]), _mm_load_ps(&other.m_y[i]))),
+            _mm_mul_ps(_mm_load_ps(&m_z[i]), _mm_load_ps(&other.m_z[i])));
+          _mm_storeu_ps(out + i, d);
+        }
+#endif
+        for (; i < m_size; ++i) {
+          out[i] = m_x[i] * other.m_x[i] + m_y[i] * other.m_y[i] + m_z[i] * other.m_z[i];
+        }
+      }
+
+      /*
+        *  @brief Writes out[i] = this[i].cross(other[i]).
+        *  @param other Stream to cross with
+        *  @param out Output stream, resized to size(). Must not be this or other.
+      */
+      inline void cross(const Vector3SoA& other, Vector3SoA& out) const {
+        out.resize(m_size);
+        size_t i = 0;
+        size_t n = m_x.size();
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = crossAVX2(other, out);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        for (; i + 4 <= n; i += 4) {
+          __m128 ax = _mm_load_ps(&m_x[i]), ay = _mm_load_ps(&m_y[i]), az = _mm_load_ps(&m_z[i]);
+          __m128 bx = _mm_load_ps(&other.m_x[i]), by = _mm_load_ps(&other.m_y[i]), bz = _mm_load_ps(&other.m_z[i]);
+          _mm_store_ps(&out.m_x[i], _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+          _mm_store_ps(&out.m_y[i], _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+          _mm_store_ps(&out.m_z[i], _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+        }
+#endif
+        for (; i < n; ++i) {
+          out.m_x[i] = m_y[i] * other.m_z[i] - m_z[i] * other.m_y[i];
+          out.m_y[i] = m_z[i] * other.m_x[i] - m_x[i] * other.m_z[i];
+          out.m_z[i] = m_x[i] * other.m_y[i] - m_y[i] * other.m_x[i];
+        }
+      }
+
+      /*
+        *  @brief Normalizes every vector in place. Vectors shorter than EPSILON become zero,
+        *  matching Vector3::normalize.
+        *  @return Reference to this stream
+      */
+      inline Vector3SoA& normalize() {
+        size_t i = 0;
+        size_t n = m_x.size();
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = normalizeAVX2();
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        const __m128 epsSq = _mm_set1_ps(Math::EPSILON * Math::EPSILON);
+        for (; i + 4 <= n; i += 4) {
+          __m128 vx = _mm_load_ps(&m_x[i]), vy = _mm_load_ps(&m_y[i]), vz = _mm_load_ps(&m_z[i]);
+          __m128 sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+          __m128 e = _mm_rsqrt_ps(sq);
+          e = _mm_mul_ps(e, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), sq), _mm_mul_ps(e, e))));
+          e = _mm_and_ps(e, _mm_cmpgt_ps(sq, epsSq));
+          _mm_store_ps(&m_x[i], _mm_mul_ps(vx, e));
+          _mm_store_ps(&m_y[i], _mm_mul_ps(vy, e));
+          _mm_store_ps(&m_z[i], _mm_mul_ps(vz, e));
+        }
+#endif
+        for (; i < n; ++i) {
+          float sq = m_x[i] * m_x[i] + m_y[i] * m_y[i] + m_z[i] * m_z[i];
+          float inv = (sq > Math::EPSILON * Math::EPSILON) ? Math::rsqrt(sq) : 0.0f;
+          m_x[i] *= inv;
+          m_y[i] *= inv;
+          m_z[i] *= inv;
+        }
+        return *this;
+      }
+
+      /*
+        *  @brief Writes out[i] = this[i].squareMagnitude().
+        *  @param out Output array of size() floats
+      */
+      inline void lengthSq(float* out) const {
+        dot(*this, out);
+      }
+
+      /*
+        *  @brief Writes out[i] = this[i].distance(other[i]).
+        *  @param other Stream to measure distance to
+        *  @param out Output array of size() floats
+      */
+      inline void distance(const Vector3SoA& other, float* out) const {
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = distanceAVX2(other, out);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        for (; i + 4 <= m_size; i += 4) {
+          __m128 dx = _mm_sub_ps(_mm_load_ps(&m_x[i]), _mm_load_ps(&other.m_x[i]));
+          __m128 dy = _mm_sub_ps(_mm_load_ps(&m_y[i]), _mm_load_ps(&other.m_y[i]));
+          __m128 dz = _mm_sub_ps(_mm_load_ps(&m_z[i]), _mm_load_ps(&other.m_z[i]));
+          __m128 sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+          _mm_storeu_ps(out + i, _mm_sqrt_ps(sq));
+        }
+#endif
+        for (; i < m_size; ++i) {
+          float dx = m_x[i] - other.m_x[i];
+          float dy = m_y[i] - other.m_y[i];
+          float dz = m_z[i] - other.m_z[i];
+          out[i] = Math::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+      }
+
+    private:
+      /*
+        *  @brief Rounds count up to a multiple of LANE_PADDING.
+      */
+      static inline size_t paddedCount(size_t count) {
+        return (count + LANE_PADDING - 1) / LANE_PADDING * LANE_PADDING;
+      }
+
+      /*
+        *  @brief dst[i] += src[i] over a padded stream.
+      */
+      static inline void addStream(float* dst, const float* src, size_t n) {
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = addStreamAVX2(dst, src, n);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        for (; i + 4 <= n; i += 4) {
+          _mm_store_ps(dst + i, _mm_add_ps(_mm_load_ps(dst + i), _mm_load_ps(src + i)));
+        }
+#endif
+        for (; i < n; ++i) {
+          dst[i] += src[i];
+        }
+      }
+
+      /*
+        *  @brief dst[i] *= scalar over a padded stream.
+      */
+      static inline void scaleStream(float* dst, float scalar, size_t n) {
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+        if (SIMD::hasAVX2()) {
+          i = scaleStreamAVX2(dst, scalar, n);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SIMD_SSE2)
+        const __m128 s = _mm_set1_ps(scalar);
+        for (; i + 4 <= n; i += 4) {
+          _mm_store_ps(dst + i, _mm_mul_ps(_mm_load_ps(dst + i), s));
+        }
+#endif
+        for (; i < n; ++i) {
+          dst[i] *= scalar;
+        }
+      }
+
+#if defined(ENGINEUTILITIES_SIMD_AVX2_DISPATCH)
+      ENGINEUTILITIES_TARGET_AVX2 static inline size_t addStreamAVX2(float* dst, const float* src, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+          _mm256_store_ps(dst + i, _mm256_add_ps(_mm256_load_ps(dst + i), _mm256_load_ps(src + i)));
+        }
+        return i;
+      }
+
+      ENGINEUTILITIES_TARGET_AVX2 static inline size_t scaleStreamAVX2(float* dst, float scalar, size_t n) {
+        const __m256 s = _mm256_set1_ps(scalar);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+          _mm256_store_ps(dst + i, _mm256_mul_ps(_mm256_load_ps(dst + i), s));
+        }
+        return i;
+      }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline size_t dotAVX2(const Vector3SoA& other, float* out) const {
+        size_t i = 0;
+        for (; i + 8 <= m_size; i += 8) {
+          __m256 d = _mm256_mul_ps(_mm256_load_ps(&m_x[i]), _mm256_load_ps(&other.m_x[i]));
+          d = _mm256_fmadd_ps(_mm256_load_ps(&m_y[i]), _mm256_load_ps(&other.m_y[i]), d);
+          d = _mm256_fmadd_ps(_mm256_load_ps(&m_z[i]), _mm256_load_ps(&other.m_z[i]), d);
+          _mm256_storeu_ps(out + i, d);
+        }
+        return i;
+      }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline size_t crossAVX2(const Vector3SoA& other, Vector3SoA& out) const {
+        size_t i = 0;
+        size_t n = m_x.size();
+        for (; i + 8 <= n; i += 8) {
+          __m256 ax = _mm256_load_ps(&m_x[i]), ay = _mm256_load_ps(&m_y[i]), az = _mm256_load_ps(&m_z[i]);
+          __m256 bx = _mm256_load_ps(&other.m_x[i]), by = _mm256_load_ps(&other.m_y[i]), bz = _mm256_load_ps(&other.m_z[i]);
+          _mm256_store_ps(&out.m_x[i], _mm256_fmsub_ps(ay, bz, _mm256_mul_ps(az, by)));
+          _mm256_store_ps(&out.m_y[i], _mm256_fmsub_ps(az, bx, _mm256_mul_ps(ax, bz)));
+          _mm256_store_ps(&out.m_z[i], _mm256_fmsub_ps(ax, by, _mm256_mul_ps(ay, bx)));
+        }
+        return i;
+      }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline size_t normalizeAVX2() {
+        const __m256 epsSq = _mm256_set1_ps(Math::EPSILON * Math::EPSILON);
+        size_t i = 0;
+        size_t n = m_x.size();
+        for (; i + 8 <= n; i += 8) {
+          __m256 vx = _mm256_load_ps(&m_x[i]), vy = _mm256_load_ps(&m_y[i]), vz = _mm256_load_ps(&m_z[i]);
+          __m256 sq = _mm256_fmadd_ps(vz, vz, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vx, vx)));
+          __m256 e = _mm256_rsqrt_ps(sq);
+          __m256 halfSqE = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), sq), e);
+          e = _mm256_mul_ps(e, _mm256_fnmadd_ps(halfSqE, e, _mm256_set1_ps(1.5f)));
+          e = _mm256_and_ps(e, _mm256_cmp_ps(sq, epsSq, _CMP_GT_OQ));
+          _mm256_store_ps(&m_x[i], _mm256_mul_ps(vx, e));
+          _mm256_store_ps(&m_y[i], _mm256_mul_ps(vy, e));
+          _mm256_store_ps(&m_z[i], _mm256_mul_ps(vz, e));
+        }
+        return i;
+      }
+
+      ENGINEUTILITIES_TARGET_AVX2 inline size_t distanceAVX2(const Vector3SoA& other, float* out) const {
+        size_t i = 0;
+        for (; i + 8 <= m_size; i += 8) {
+          __m256 dx = _mm256_sub_ps(_mm256_load_ps(&m_x[i]), _mm256_load_ps(&other.m_x[i]));
+          __m256 dy = _mm256_sub_ps(_mm256_load_ps(&m_y[i]), _mm256_load_ps(&other.m_y[i]));
+          __m256 dz = _mm256_sub_ps(_mm256_load_ps(&m_z[i]), _mm256_load_ps(&other.m_z[i]));
+          __m256 sq = _mm256_fmadd_ps(dz, dz, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dx, dx)));
+          _mm256_storeu_ps(out + i, _mm256_sqrt_ps(sq));
+        }
+        return i;
+      }
+#endif
+
+      Stream m_x;
+      Stream m_y;
+      Stream m_z;
+      size_t m_size;
+    };
+
+  }
+}
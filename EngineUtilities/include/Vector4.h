@@ -1,35 +1,48 @@
 #pragma once
-#include "EngineUtilites.h"
+#include <iostream>
 #include "EngineMath.h"
+#include "EngineHalf.h"
+#include "EngineSIMD.h"
+#include <cstddef>
+#include <type_traits>
 
 namespace EngineUtilities {
   namespace Vectors {
 
     /*
-      *  @brief Represents a 4D vector with float components.
+      *  @brief Represents a 4D vector, templated over the component type.
+      *  Vector4 (float) arithmetic maps onto one 128-bit register (SSE2 / NEON) when available;
+      *  define ENGINEUTILITIES_ALIGNED_VEC4 to also make its storage 16-byte aligned.
+      *  Vector4d and Vector4h (half storage) always take the scalar path.
     */
-    struct Vector4 {
+    template <typename T>
+    struct ENGINEUTILITIES_ALIGN_VEC4(T) TVector4 {
+      /*
+        *  @brief Scalar type of the components.
+      */
+      using value_type = T;
+
       /*
         *  @brief X component of the vector.
       */
-      float x; 
+      T x; 
       /*
         *  @brief Y component of the vector.
       */
-      float y; 
+      T y; 
       /*
         *  @brief Z component of the vector.
       */
-      float z; 
+      T z; 
       /*
         *  @brief W component of the vector.
       */
-      float w;
+      T w;
 
       /*
         *  @brief Default constructor. Initializes all components to 0.0f.
       */
-      inline Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+      constexpr TVector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
 
       /*
         *  @brief Constructs a Vector4 with specified components.
@@ -38,36 +51,58 @@ namespace EngineUtilities {
         *  @param inZ Z component.
         *  @param inW W component.
       */
-      inline Vector4(float inX, float inY, float inZ, float inW) : x(inX), y(inY), z(inZ), w(inW) {}
+      constexpr TVector4(T inX, T inY, T inZ, T inW) : x(inX), y(inY), z(inZ), w(inW) {}
 
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
       /*
-        *  @brief Assignment operator.
-        *  @param other Vector4 to copy from.
-        *  @return Reference to this vector.
+        *  @brief Loads the four components into a SIMD register.
+        *  @return Register holding (x, y, z, w).
       */
-      inline Vector4& operator=(const Vector4& other) {
-        x = other.x;
-        y = other.y;
-        z = other.z;
-        w = other.w;
-        return *this;
+      inline SIMD::float4 load() const {
+        return SIMD::load4(&x);
+      }
+
+      /*
+        *  @brief Builds a Vector4 from a SIMD register.
+        *  @param v Register holding (x, y, z, w).
+        *  @return Resulting Vector4.
+      */
+      static inline TVector4 fromSIMD(SIMD::float4 v) {
+        TVector4 result;
+        SIMD::store4(&result.x, v);
+        return result;
       }
+#endif
 
       /*
         *  @brief Adds two Vector4 objects.
         *  @param other Vector4 to add.
         *  @return Resulting Vector4.
       */
-      inline Vector4 operator+(const Vector4& other) const {
-        return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
+      constexpr TVector4 operator+(const TVector4& other) const {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            return fromSIMD(SIMD::add4(load(), other.load()));
+          }
+        }
+#endif
+        return TVector4(x + other.x, y + other.y, z + other.z, w + other.w);
       }
       /*
         *  @brief Subtracts another Vector4 from this one.
         *  @param other Vector4 to subtract.
         *  @return Resulting Vector4.
       */
-      inline Vector4 operator-(const Vector4& other) const {
-        return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
+      constexpr TVector4 operator-(const TVector4& other) const {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            return fromSIMD(SIMD::sub4(load(), other.load()));
+          }
+        }
+#endif
+        return TVector4(x - other.x, y - other.y, z - other.z, w - other.w);
       }
 
       /*
@@ -75,19 +110,26 @@ namespace EngineUtilities {
         *  @param scalar Scalar value.
         *  @return Resulting Vector4.
       */
-      inline Vector4 operator*(float scalar) const {
-        return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
+      constexpr TVector4 operator*(T scalar) const {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            return fromSIMD(SIMD::mul4(load(), SIMD::splat4(scalar)));
+          }
+        }
+#endif
+        return TVector4(x * scalar, y * scalar, z * scalar, w * scalar);
       }
       /*
         *  @brief Divides the vector by a scalar.
         *  @param scalar Scalar value.
         *  @return Resulting Vector4.
       */
-      inline Vector4 operator/(float scalar) const {
+      constexpr TVector4 operator/(T scalar) const {
         if (scalar != 0.0f) {
-          return Vector4(x / scalar, y / scalar, z / scalar, w / scalar);
+          return TVector4(x / scalar, y / scalar, z / scalar, w / scalar);
         }
-        return Vector4();
+        return TVector4();
       }
 
       /*
@@ -95,7 +137,15 @@ namespace EngineUtilities {
         *  @param other Vector4 to add.
         *  @return Reference to this vector.
       */
-      inline Vector4& operator+=(const Vector4& other) {
+      constexpr TVector4& operator+=(const TVector4& other) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            SIMD::store4(&x, SIMD::add4(load(), other.load()));
+            return *this;
+          }
+        }
+#endif
         x += other.x;
         y += other.y;
         z += other.z;
@@ -107,7 +157,15 @@ namespace EngineUtilities {
         *  @param other Vector4 to subtract.
         *  @return Reference to this vector.
       */
-      inline Vector4& operator-=(const Vector4& other) {
+      constexpr TVector4& operator-=(const TVector4& other) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            SIMD::store4(&x, SIMD::sub4(load(), other.load()));
+            return *this;
+          }
+        }
+#endif
         x -= other.x;
         y -= other.y;
         z -= other.z;
@@ -119,7 +177,15 @@ namespace EngineUtilities {
         *  @param scalar Scalar value.
         *  @return Reference to this vector.
       */
-      inline Vector4& operator*=(float scalar) {
+      constexpr TVector4& operator*=(T scalar) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            SIMD::store4(&x, SIMD::mul4(load(), SIMD::splat4(scalar)));
+            return *this;
+          }
+        }
+#endif
         x *= scalar;
         y *= scalar;
         z *= scalar;
@@ -131,7 +197,7 @@ namespace EngineUtilities {
         *  @param scalar Scalar value.
         *  @return Reference to this vector.
       */
-      inline Vector4& operator/=(float scalar) {
+      constexpr TVector4& operator/=(T scalar) {
         if (scalar != 0.0f) {
           x /= scalar;
           y /= scalar;
@@ -146,7 +212,7 @@ namespace EngineUtilities {
         *  @param other Vector4 to compare.
         *  @return True if equal, false otherwise.
       */
-      inline bool operator==(const Vector4& other) const {
+      constexpr bool operator==(const TVector4& other) const {
         return Math::approxEqual(x, other.x) &&
           Math::approxEqual(y, other.y) &&
           Math::approxEqual(z, other.z) &&
@@ -157,7 +223,7 @@ namespace EngineUtilities {
         *  @param other Vector4 to compare.
         *  @return True if not equal, false otherwise.
       */
-      inline bool operator!=(const Vector4& other) const {
+      constexpr bool operator!=(const TVector4& other) const {
         return !(*this == other);
       }
 
@@ -166,37 +232,41 @@ namespace EngineUtilities {
         *  @param other Vector4 to dot with.
         *  @return Dot product value.
       */
-      inline float dot(const Vector4& other) const {
+      constexpr T dot(const TVector4& other) const {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            return SIMD::dot4(load(), other.load());
+          }
+        }
+#endif
         return x * other.x + y * other.y + z * other.z + w * other.w;
       }
 
       /*
         *  @brief Returns the magnitude (length) of the vector.
-        *  @return Magnitude as a float.
+        *  @return Magnitude as a T.
       */
-      inline float magnitude() const {
-        return Math::sqrt(x * x + y * y + z * z + w * w);
+      constexpr T magnitude() const {
+        return Math::sqrt(squareMagnitude());
       }
 
       /*
         *  @brief Returns the squared magnitude of the vector.
-        *  @return Squared magnitude as a float.
+        *  @return Squared magnitude as a T.
       */
-      inline float squareMagnitude() const {
-        return x * x + y * y + z * z + w * w;
+      constexpr T squareMagnitude() const {
+        return dot(*this);
       }
 
       /*
         *  @brief Normalizes the vector in-place.
         *  @return Reference to this vector.
       */
-      inline Vector4& normalize() {
-        float mag = magnitude();
-        if (mag > Math::EPSILON) {
-          x /= mag;
-          y /= mag;
-          z /= mag;
-          w /= mag;
+      constexpr TVector4& normalize() {
+        T sqMag = squareMagnitude();
+        if (sqMag > Math::Constants<T>::EPSILON * Math::Constants<T>::EPSILON) {
+          *this *= Math::rsqrt(sqMag);
         }
         return *this;
       }
@@ -205,49 +275,111 @@ namespace EngineUtilities {
         *  @brief Returns a normalized copy of the vector.
         *  @return Normalized Vector4.
       */
-      inline Vector4 normalized() const {
-        float mag = magnitude();
-        if (mag > Math::EPSILON) {
-          return Vector4(x / mag, y / mag, z / mag, w / mag);
+      constexpr TVector4 normalized() const {
+        T sqMag = squareMagnitude();
+        if (sqMag > Math::Constants<T>::EPSILON * Math::Constants<T>::EPSILON) {
+          return *this * Math::rsqrt(sqMag);
         }
-        return Vector4();
+        return TVector4();
       }
 
       /*
         *  @brief Calculates the distance to another Vector4.
         *  @param other Vector4 to measure distance to.
-        *  @return Distance as a float.
+        *  @return Distance as a T.
       */
-      inline float distance(const Vector4& other) const {
-        float dx = x - other.x;
-        float dy = y - other.y;
-        float dz = z - other.z;
-        float dw = w - other.w;
-        return Math::sqrt(dx * dx + dy * dy + dz * dz + dw * dw);
+      constexpr T distance(const TVector4& other) const {
+        return Math::sqrt(squareDistance(other));
       }
 
       /*
         *  @brief Calculates the squared distance to another Vector4.
         *  @param other Vector4 to measure squared distance to.
-        *  @return Squared distance as a float.
+        *  @return Squared distance as a T.
       */
-      inline float squareDistance(const Vector4& other) const {
-        float dx = x - other.x;
-        float dy = y - other.y;
-        float dz = z - other.z;
-        float dw = w - other.w;
+      constexpr T squareDistance(const TVector4& other) const {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        if constexpr (std::is_same<T, float>::value) {
+          if (!ENGINEUTILITIES_IS_CONSTANT_EVALUATED()) {
+            SIMD::float4 d = SIMD::sub4(load(), other.load());
+            return SIMD::dot4(d, d);
+          }
+        }
+#endif
+        T dx = x - other.x;
+        T dy = y - other.y;
+        T dz = z - other.z;
+        T dw = w - other.w;
         return dx * dx + dy * dy + dz * dz + dw * dw;
       }
+
+      /*
+        *  @brief Range check without a square root.
+        *  @param other Vector4 to measure distance to.
+        *  @param radius Non-negative range.
+        *  @return True if the distance to other is less than radius.
+      */
+      constexpr bool distanceLessThan(const TVector4& other, T radius) const {
+        return squareDistance(other) < radius * radius;
+      }
+
+      /*
+        *  @brief Closest of count points to this one (ties go to the lower index).
+        *  See nearestOfBatch (VectorBatch.h) for the SIMD version over float arrays.
+        *  @param points Points to search.
+        *  @param count Number of points.
+        *  @param outSquareDistance Optional output squared distance to the returned point.
+        *  @return Index of the closest point, or count if count is 0.
+      */
+      constexpr size_t nearestOf(const TVector4* points, size_t count, T* outSquareDistance = nullptr) const {
+        if (count == 0) {
+          return count;
+        }
+        size_t best = 0;
+        T bestSq = squareDistance(points[0]);
+        for (size_t i = 1; i < count; ++i) {
+          T sq = squareDistance(points[i]);
+          if (sq < bestSq) {
+            bestSq = sq;
+            best = i;
+          }
+        }
+        if (outSquareDistance) {
+          *outSquareDistance = bestSq;
+        }
+        return best;
+      }
     };
 
+    using Vector4 = TVector4<float>;
+    using Vector4d = TVector4<double>;
+    using Vector4h = TVector4<Math::half>;
+
+    static_assert(sizeof(Vector4) == 4 * sizeof(float), "Vector4 must stay four packed floats");
+    static_assert(sizeof(Vector4d) == 4 * sizeof(double), "Vector4d must stay four packed doubles");
+    static_assert(sizeof(Vector4h) == 4 * sizeof(Math::half), "Vector4h must stay four packed halves");
+    static_assert(std::is_trivially_copyable<Vector4>::value, "Vector4 must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector4d>::value, "Vector4d must be trivially copyable");
+    static_assert(std::is_trivially_copyable<Vector4h>::value, "Vector4h must be trivially copyable");
+    static_assert(std::is_standard_layout<Vector4>::value, "Vector4 must be standard layout");
+    static_assert(std::is_standard_layout<Vector4d>::value, "Vector4d must be standard layout");
+    static_assert(std::is_standard_layout<Vector4h>::value, "Vector4h must be standard layout");
+    static_assert(offsetof(Vector4, w) == 3 * sizeof(float), "Vector4 components must be laid out as x, y, z, w");
+#if defined(ENGINEUTILITIES_ALIGNED_VEC4)
+    static_assert(alignof(Vector4) == 16, "Vector4 must be 16-byte aligned in ENGINEUTILITIES_ALIGNED_VEC4 mode");
+#else
+    static_assert(alignof(Vector4) == alignof(float), "Vector4 must keep float alignment");
+#endif
+
     /*
       *  @brief Multiplies a scalar by a Vector4.
       *  @param scalar Scalar value.
       *  @param vec Vector4 to multiply.
       *  @return Resulting Vector4.
     */
-    inline Vector4 operator*(float scalar, const Vector4& vec) {
-      return Vector4(vec.x * scalar, vec.y * scalar, vec.z * scalar, vec.w * scalar);
+    template <typename T>
+    constexpr TVector4<T> operator*(typename TVector4<T>::value_type scalar, const TVector4<T>& vec) {
+      return vec * scalar;
     }
 
     /*
@@ -256,7 +388,8 @@ namespace EngineUtilities {
       *  @param v Vector4 to output.
       *  @return Reference to the output stream.
     */
-    inline std::ostream& operator<<(std::ostream& os, const Vector4& v) {
+    template <typename T>
+    inline std::ostream& operator<<(std::ostream& os, const TVector4<T>& v) {
       os << "(" << v.x << ", " << v.y << ", " << v.z << ", " << v.w << ")";
       return os;
     }
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineSIMD.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace EngineUtilities {
+  namespace Vectors {
+
+    namespace detail {
+      /*
+        *  @brief Lane mask bit counts, for the 4-bit masks of movemask4.
+      */
+      constexpr unsigned char MASK_BIT_COUNT[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+      /*
+        *  @brief Squared distances from target to points[0..3], one lane each (AoS loads transposed to SoA).
+      */
+      inline SIMD::float4 squareDistance4(const Vector2& target, const Vector2* points) {
+        using namespace SIMD;
+        float4 x, y;
+        deinterleave4(loadu4(&points[0].x), loadu4(&points[2].x), x, y);
+        float4 dx = sub4(x, splat4(target.x)), dy = sub4(y, splat4(target.y));
+        return add4(mul4(dx, dx), mul4(dy, dy));
+      }
+
+      /*
+        *  Each 4-float load of a Vector3 also reads the next point's x, so blocks of Vector3 stop
+        *  one point early (see simdEnd).
+      */
+      inline SIMD::float4 squareDistance4(const Vector3& target, const Vector3* points) {
+        using namespace SIMD;
+        float4 x = loadu4(&points[0].x), y = loadu4(&points[1].x), z = loadu4(&points[2].x), w = loadu4(&points[3].x);
+        transpose4(x, y, z, w);
+        float4 dx = sub4(x, splat4(target.x)), dy = sub4(y, splat4(target.y)), dz = sub4(z, splat4(target.z));
+        return add4(add4(mul4(dx, dx), mul4(dy, dy)), mul4(dz, dz));
+      }
+
+      inline SIMD::float4 squareDistance4(const Vector4& target, const Vector4* points) {
+        using namespace SIMD;
+        float4 x = loadu4(&points[0].x), y = loadu4(&points[1].x), z = loadu4(&points[2].x), w = loadu4(&points[3].x);
+        transpose4(x, y, z, w);
+        float4 dx = sub4(x, splat4(target.x)), dy = sub4(y, splat4(target.y));
+        float4 dz = sub4(z, splat4(target.z)), dw = sub4(w, splat4(target.w));
+        return add4(add4(mul4(dx, dx), mul4(dy, dy)), add4(mul4(dz, dz), mul4(dw, dw)));
+      }
+
+      /*
+        *  @brief squareDistance4 over the last count (1..4) points, copied into a zero-padded block.
+        *  Gives the same rounding as the full blocks, which the scalar squareDistance may not
+        *  (the compiler is free to contract it into FMAs).
+      */
+      template <typename V>
+      inline SIMD::float4 squareDistancePartial4(const V& target, const V* points, size_t count) {
+        V block[5] = {};
+        for (size_t k = 0; k < count; ++k) {
+          block[k] = points[k];
+        }
+        return squareDistance4(target, block);
+      }
+#endif
+
+      /*
+        *  @brief End of the range of 4-point SIMD blocks over n points (the rest runs scalar).
+      */
+      template <typename V>
+      constexpr size_t simdEnd(size_t n) {
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        const size_t overread = std::is_same<V, Vector3>::value ? 1 : 0;
+        return n > overread ? ((n - overread) & ~size_t(3)) : 0;
+#else
+        (void)n;
+        return 0;
+#endif
+      }
+
+      template <typename V>
+      inline void squareDistanceBatch(const V& target, const V* points, size_t n, float* out) {
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        for (const size_t end = simdEnd<V>(n); i < end; i += 4) {
+          SIMD::storeu4(out + i, squareDistance4(target, points + i));
+        }
+#endif
+        for (; i < n; ++i) {
+          out[i] = target.squareDistance(points[i]);
+        }
+      }
+
+      template <typename V>
+      inline size_t distanceLessThanBatch(const V& target, float radius, const V* points, size_t n, unsigned char* out) {
+        const float radiusSq = radius * radius;
+        size_t count = 0;
+        size_t i = 0;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        const SIMD::float4 limit = SIMD::splat4(radiusSq);
+        for (const size_t end = simdEnd<V>(n); i < end; i += 4) {
+          int mask = SIMD::movemask4(SIMD::cmplt4(squareDistance4(target, points + i), limit));
+          out[i] = static_cast<unsigned char>(mask & 1);
+          out[i + 1] = static_cast<unsigned char>((mask >> 1) & 1);
+          out[i + 2] = static_cast<unsigned char>((mask >> 2) & 1);
+          out[i + 3] = static_cast<unsigned char>((mask >> 3) & 1);
+          count += MASK_BIT_COUNT[mask];
+        }
+#endif
+        for (; i < n; ++i) {
+          out[i] = target.squareDistance(points[i]) < radiusSq ? 1 : 0;
+          count += out[i];
+        }
+        return count;
+      }
+
+      /*
+        *  @brief One pass keeping, per lane, the smallest squared distance and its index. Indices
+        *  ride in float lanes, exact below 2^24, so the array is walked in chunks of that size.
+      */
+      template <typename V>
+      inline size_t nearestOfBatch(const V& target, const V* points, size_t n, float* outSquareDistance) {
+        if (n == 0) {
+          return n;
+        }
+        size_t best = 0;
+        size_t i = 1;
+#if defined(ENGINEUTILITIES_SIMD_FLOAT4)
+        // Seed and tail go through squareDistance4 as well, so equal points always compare equal.
+        float seed[4];
+        SIMD::storeu4(seed, squareDistancePartial4(target, points, 1));
+        float bestSq = seed[0];
+        const size_t CHUNK = size_t(1) << 24;
+        const size_t end = simdEnd<V>(n);
+        for (i = 0; i < end;) {
+          const size_t chunkBegin = i;
+          const size_t chunkEnd = (end - i > CHUNK) ? i + CHUNK : end;
+          SIMD::float4 laneSq = SIMD::splat4(bestSq);
+          SIMD::float4 laneIndex = SIMD::splat4(0.0f);
+          SIMD::float4 index = SIMD::set4(0.0f, 1.0f, 2.0f, 3.0f);
+          const SIMD::float4 step = SIMD::splat4(4.0f);
+          for (; i < chunkEnd; i += 4) {
+            SIMD::float4 sq = squareDistance4(target, points + i);
+            SIMD::float4 closer = SIMD::cmplt4(sq, laneSq);
+            laneSq = SIMD::select4(closer, sq, laneSq);
+            laneIndex = SIMD::select4(closer, index, laneIndex);
+            index = SIMD::add4(index, step);
+          }
+          float sq[4], at[4];
+          SIMD::storeu4(sq, laneSq);
+          SIMD::storeu4(at, laneIndex);
+          int improved = SIMD::movemask4(SIMD::cmplt4(laneSq, SIMD::splat4(bestSq)));
+          for (int lane = 0; lane < 4; ++lane) {
+            size_t candidate = chunkBegin + static_cast<size_t>(at[lane]);
+            if (((improved >> lane) & 1) && (sq[lane] < bestSq || (sq[lane] == bestSq && candidate < best))) {
+              bestSq = sq[lane];
+              best = candidate;
+            }
+          }
+        }
+        if (i == 0) {
+          i = 1;
+        }
+        for (; i < n; i += 4) {
+          const size_t count = (n - i < 4) ? n - i : 4;
+          float sq[4];
+          SIMD::storeu4(sq, squareDistancePartial4(target, points + i, count));
+          for (size_t lane = 0; lane < count; ++lane) {
+            if (sq[lane] < bestSq) {
+              bestSq = sq[lane];
+              best = i + lane;
+            }
+          }
+        }
+#else
+        float bestSq = target.squareDistance(points[0]);
+        for (; i < n; ++i) {
+          float sq = target.squareDistance(points[i]);
+          if (sq < bestSq) {
+            bestSq = sq;
+            best = i;
+          }
+        }
+#endif
+        if (outSquareDistance) {
+          *outSquareDistance = bestSq;
+        }
+        return best;
+      }
+    }
+
+    /*
+      *  @brief Writes out[i] = target.squareDistance(points[i]), four points per SIMD step.
+    */
+    inline void squareDistanceBatch(const Vector2& target, const Vector2* points, size_t n, float* out) {
+      detail::squareDistanceBatch(target, points, n, out);
+    }
+    inline void squareDistanceBatch(const Vector3& target, const Vector3* points, size_t n, float* out) {
+      detail::squareDistanceBatch(target, points, n, out);
+    }
+    inline void squareDistanceBatch(const Vector4& target, const Vector4* points, size_t n, float* out) {
+      detail::squareDistanceBatch(target, points, n, out);
+    }
+
+    /*
+      *  @brief Writes out[i] = target.distanceLessThan(points[i], radius) as 0 / 1.
+      *  @return Number of points closer than radius.
+    */
+    inline size_t distanceLessThanBatch(const Vector2& target, float radius, const Vector2* points, size_t n,
+                                        unsigned char* out) {
+      return detail::distanceLessThanBatch(target, radius, points, n, out);
+    }
+    inline size_t distanceLessThanBatch(const Vector3& target, float radius, const Vector3* points, size_t n,
+                                        unsigned char* out) {
+      return detail::distanceLessThanBatch(target, radius, points, n, out);
+    }
+    inline size_t distanceLessThanBatch(const Vector4& target, float radius, const Vector4* points, size_t n,
+                                        unsigned char* out) {
+      return detail::distanceLessThanBatch(target, radius, points, n, out);
+    }
+
+    /*
+      *  @brief target.nearestOf(points, n, outSquareDistance) in one SIMD pass:
+      *  index of the closest point (lowest index on ties, n if n is 0) and its squared distance.
+      *  Every point is measured with the same unfused arithmetic, so repeated points always tie;
+      *  distinct points whose distances differ only by rounding may resolve differently from the
+      *  scalar nearestOf when the compiler contracts that one into FMAs.
+    */
+    inline size_t nearestOfBatch(const Vector2& target, const Vector2* points, size_t n,
+                                 float* outSquareDistance = nullptr) {
+      return detail::nearestOfBatch(target, points, n, outSquareDistance);
+    }
+    inline size_t nearestOfBatch(const Vector3& target, const Vector3* points, size_t n,
+                                 float* outSquareDistance = nullptr) {
+      return detail::nearestOfBatch(target, points, n, outSquareDistance);
+    }
+    inline size_t nearestOfBatch(const Vector4& target, const Vector4* points, size_t n,
+                                 float* outSquareDistance = nullptr) {
+      return detail::nearestOfBatch(target, points, n, outSquareDistance);
+    }
+
+  }
+}
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "EngineMath.h"
+#include "EngineParallel.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace EngineUtilities {
+  namespace Vectors {
+
+    /*
+      *  @brief Lazy expression layer over Vector3 / Vector4 values and arrays.
+      *  Wrapping operands with lazy() turns a + b * s - c into a tree of small nodes instead of
+      *  one temporary per operator; assigning the tree to a span() evaluates it in a single loop
+      *  over the flat components (x0 y0 z0 x1 ...), which the compiler can vectorize. Only
+      *  component-wise operations are lazy (+, -, negation, scalar * and /); use the eager
+      *  members for dot, cross and normalize.
+      *
+      *    span(positions) += lazy(velocities) * dt;
+      *    Vector3 r = evaluate(lazy(a) + lazy(b) * s - lazy(c));
+      *
+      *  All arrays in one expression must hold the same number of vectors; a single lazy(v) is not
+      *  broadcast over an array (debug builds assert on mismatched sizes). The destination may be
+      *  one of the operands: every component is read before it is written.
+    */
+
+    /*
+      *  @brief CRTP base of every expression node.
+      *  Nodes expose vector_type, size() (number of vectors) and at(k) (flat component k).
+    */
+    template <typename E>
+    struct VectorExpr {
+      constexpr const E& self() const {
+        return static_cast<const E&>(*this);
+      }
+    };
+
+    /*
+      *  @brief Read-only view of count consecutive vectors.
+    */
+    template <typename V>
+    struct VectorLeaf : VectorExpr<VectorLeaf<V>> {
+      using vector_type = V;
+      using value_type = typename V::value_type;
+
+      /*
+        *  @brief Components per vector (3 for TVector3, 4 for TVector4).
+      */
+      static constexpr size_t COMPONENTS = sizeof(V) / sizeof(value_type);
+
+      const value_type* data;
+      size_t count;
+
+      // An empty std::vector hands out nullptr, which must not be dereferenced.
+      constexpr VectorLeaf(const V* vectors, size_t n) : data(n == 0 ? nullptr : &vectors->x), count(n) {}
+
+      constexpr size_t size() const { return count; }
+      constexpr value_type at(size_t k) const { return data[k]; }
+    };
+
+    /*
+      *  @brief Component-wise sum of two expressions.
+    */
+    template <typename L, typename R>
+    struct VectorAdd : VectorExpr<VectorAdd<L, R>> {
+      using vector_type = typename L::vector_type;
+      static_assert(std::is_same<vector_type, typename R::vector_type>::value,
+                    "both operands must have the same vector type");
+      L lhs;
+      R rhs;
+
+      constexpr VectorAdd(const L& l, const R& r) : lhs(l), rhs(r) {
+        assert(lhs.size() == rhs.size() && "operands must hold the same number of vectors");
+      }
+
+      constexpr size_t size() const { return lhs.size(); }
+      constexpr auto at(size_t k) const { return lhs.at(k) + rhs.at(k); }
+    };
+
+    /*
+      *  @brief Component-wise difference of two expressions.
+    */
+    template <typename L, typename R>
+    struct VectorSub : VectorExpr<VectorSub<L, R>> {
+      using vector_type = typename L::vector_type;
+      static_assert(std::is_same<vector_type, typename R::vector_type>::value,
+                    "both operands must have the same vector type");
+      L lhs;
+      R rhs;
+
+      constexpr VectorSub(const L& l, const R& r) : lhs(l), rhs(r) {
+        assert(lhs.size() == rhs.size() && "operands must hold the same number of vectors");
+      }
+
+      constexpr size_t size() const { return lhs.size(); }
+      constexpr auto at(size_t k) const { return lhs.at(k) - rhs.at(k); }
+    };
+
+    /*
+      *  @brief Negated expression.
+    */
+    template <typename E>
+    struct VectorNeg : VectorExpr<VectorNeg<E>> {
+      using vector_type = typename E::vector_type;
+      E expr;
+
+      constexpr explicit VectorNeg(const E& e) : expr(e) {}
+
+      constexpr size_t size() const { return expr.size(); }
+      constexpr auto at(size_t k) const { return -expr.at(k); }
+    };
+
+    /*
+      *  @brief Expression multiplied by a scalar. Half vectors keep the scalar in float.
+    */
+    template <typename E>
+    struct VectorScale : VectorExpr<VectorScale<E>> {
+      using vector_type = typename E::vector_type;
+      using scalar_type = decltype(std::declval<typename vector_type::value_type>() * 1.0f);
+      E expr;
+      scalar_type scalar;
+
+      constexpr VectorScale(const E& e, scalar_type s) : expr(e), scalar(s) {}
+
+      constexpr size_t size() const { return expr.size(); }
+      constexpr auto at(size_t k) const { return expr.at(k) * scalar; }
+    };
+
+    /*
+      *  @brief Wraps one vector as an expression operand.
+    */
+    template <typename T>
+    constexpr VectorLeaf<TVector3<T>> lazy(const TVector3<T>& v) {
+      return VectorLeaf<TVector3<T>>(&v, 1);
+    }
+
+    template <typename T>
+    constexpr VectorLeaf<TVector4<T>> lazy(const TVector4<T>& v) {
+      return VectorLeaf<TVector4<T>>(&v, 1);
+    }
+
+    /*
+      *  @brief Wraps n consecutive vectors as an expression operand.
+    */
+    template <typename V>
+    constexpr VectorLeaf<V> lazy(const V* data, size_t n) {
+      return VectorLeaf<V>(data, n);
+    }
+
+    template <typename V, typename A>
+    inline VectorLeaf<V> lazy(const std::vector<V, A>& vectors) {
+      return VectorLeaf<V>(vectors.data(), vectors.size());
+    }
+
+    template <typename L, typename R>
+    constexpr VectorAdd<L, R> operator+(const VectorExpr<L>& a, const VectorExpr<R>& b) {
+      return VectorAdd<L, R>(a.self(), b.self());
+    }
+
+    template <typename L, typename R>
+    constexpr VectorSub<L, R> operator-(const VectorExpr<L>& a, const VectorExpr<R>& b) {
+      return VectorSub<L, R>(a.self(), b.self());
+    }
+
+    template <typename E>
+    constexpr VectorNeg<E> operator-(const VectorExpr<E>& a) {
+      return VectorNeg<E>(a.self());
+    }
+
+    template <typename E>
+    constexpr VectorScale<E> operator*(const VectorExpr<E>& a, typename VectorScale<E>::scalar_type s) {
+      return VectorScale<E>(a.self(), s);
+    }
+
+    template <typename E>
+    constexpr VectorScale<E> operator*(typename VectorScale<E>::scalar_type s, const VectorExpr<E>& a) {
+      return VectorScale<E>(a.self(), s);
+    }
+
+    /*
+      *  @brief Scalar division, evaluated as a multiply by the reciprocal. Like the eager
+      *  operator/, a near-zero divisor yields zero vectors.
+    */
+    template <typename E>
+    constexpr VectorScale<E> operator/(const VectorExpr<E>& a, typename VectorScale<E>::scalar_type s) {
+      using S = typename VectorScale<E>::scalar_type;
+      return VectorScale<E>(a.self(), Math::abs(s) < Math::Constants<S>::EPSILON ? S(0) : S(1) / s);
+    }
+
+    /*
+      *  @brief Evaluates a one-vector expression into a value.
+    */
+    template <typename E>
+    inline typename E::vector_type evaluate(const VectorExpr<E>& e) {
+      using V = typename E::vector_type;
+      V result;
+      auto* out = &result.x;
+      for (size_t k = 0; k < VectorLeaf<V>::COMPONENTS; ++k) {
+        out[k] = e.self().at(k);
+      }
+      return result;
+    }
+
+    /*
+      *  @brief Component count above which span assignment is split across threads.
+    */
+    const
+      size_t EXPR_PARALLEL_THRESHOLD = 1 << 18;
+
+    /*
+      *  @brief Components evaluated per inner block of a span assignment.
+    */
+    const
+      size_t EXPR_BLOCK = 64;
+
+    /*
+      *  @brief Writable view of count consecutive vectors; the target of expression assignment.
+      *  A span is also an operand, so span(a) = span(a) * 2.0f works in place.
+    */
+    template <typename V>
+    class VectorSpan : public VectorExpr<VectorSpan<V>> {
+    public:
+      using vector_type = V;
+      using value_type = typename V::value_type;
+      using scalar_type = decltype(std::declval<value_type>() * 1.0f);
+      static constexpr size_t COMPONENTS = VectorLeaf<V>::COMPONENTS;
+
+      inline VectorSpan(V* vectors, size_t n) : m_data(n == 0 ? nullptr : &vectors->x), m_count(n) {}
+
+      inline VectorSpan(const VectorSpan&) = default;
+
+      inline size_t size() const { return m_count; }
+      inline value_type at(size_t k) const { return m_data[k]; }
+
+      /*
+        *  @brief Copies the elements of another span of the same size.
+      */
+      inline VectorSpan& operator=(const VectorSpan& other) {
+        return assign(other, [](value_type& out, auto value) { out = value; });
+      }
+
+      /*
+        *  @brief Evaluates e into the viewed vectors in one pass.
+      */
+      template <typename E>
+      inline VectorSpan& operator=(const VectorExpr<E>& e) {
+        return assign(e.self(), [](value_type& out, auto value) { out = value; });
+      }
+
+      template <typename E>
+      inline VectorSpan& operator+=(const VectorExpr<E>& e) {
+        return assign(e.self(), [](value_type& out, auto value) { out = out + value; });
+      }
+
+      template <typename E>
+      inline VectorSpan& operator-=(const VectorExpr<E>& e) {
+        return assign(e.self(), [](value_type& out, auto value) { out = out - value; });
+      }
+
+      inline VectorSpan& operator*=(scalar_type s) {
+        return *this = *this * s;
+      }
+
+      inline VectorSpan& operator/=(scalar_type s) {
+        return *this = *this / s;
+      }
+
+    private:
+      template <typename E, typename Op>
+      inline VectorSpan& assign(const E& e, Op op) {
+        static_assert(std::is_same<V, typename E::vector_type>::value,
+                      "expression and destination must have the same vector type");
+        assert(e.size() == m_count && "expression and destination must hold the same number of vectors");
+        value_type* out = m_data;
+        Parallel::parallelFor(0, m_count * COMPONENTS, EXPR_PARALLEL_THRESHOLD,
+          [out, &e, op](size_t begin, size_t end) {
+            // Evaluate into a local block first: the block cannot alias the operands, so the
+            // inner loop vectorizes without runtime overlap checks.
+            value_type block[EXPR_BLOCK];
+            size_t k = begin;
+            for (; k + EXPR_BLOCK <= end; k += EXPR_BLOCK) {
+              for (size_t j = 0; j < EXPR_BLOCK; ++j) {
+                block[j] = e.at(k + j);
+              }
+              for (size_t j = 0; j < EXPR_BLOCK; ++j) {
+                op(out[k + j], block[j]);
+              }
+            }
+            for (; k < end; ++k) {
+              op(out[k], e.at(k));
+            }
+          });
+        return *this;
+      }
+
+      value_type* m_data;
+      size_t m_count;
+    };
+
+    /*
+      *  @brief Views one vector, n consecutive vectors or a whole std::vector as an assignment target.
+    */
+    template <typename T>
+    inline VectorSpan<TVector3<T>> span(TVector3<T>& v) {
+      return VectorSpan<TVector3<T>>(&v, 1);
+    }
+
+    template <typename T>
+    inline VectorSpan<TVector4<T>> span(TVector4<T>& v) {
+      return VectorSpan<TVector4<T>>(&v, 1);
+    }
+
+    template <typename V>
+    inline VectorSpan<V> span(V* data, size_t n) {
+      return VectorSpan<V>(data, n);
+    }
+
+    template <typename V, typename A>
+    inline VectorSpan<V> span(std::vector<V, A>& vectors) {
+      return VectorSpan<V>(vectors.data(), vectors.size());
+    }
+
+  }
+}